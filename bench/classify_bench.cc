@@ -0,0 +1,134 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Compares the linear and the indexed classification of desktop entries into subcategories
+
+#include <time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "menu.h"
+#include "xdg/desktop_entry.h"
+
+namespace amm {
+namespace bench {
+
+static const size_t kEntryCount = 5000;
+static const size_t kCategoriesPerSubcategory = 4;
+static const size_t kRounds = 20;
+
+static double elapsedMilliseconds(const timespec &start, const timespec &end)
+{
+    return (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1000000.0;
+}
+
+static std::string categoryName(size_t number)
+{
+    std::stringstream stream;
+    stream << "X-Category-" << number;
+    return stream.str();
+}
+
+static std::vector<std::string> categoryLines(size_t subcategory_count)
+{
+    std::vector<std::string> lines;
+    for (size_t subcategory = 0; subcategory < subcategory_count; ++subcategory) {
+        std::stringstream line;
+        line << "Subcategory " << subcategory << ":icon-" << subcategory;
+        for (size_t category = 0; category < kCategoriesPerSubcategory; ++category) {
+            line << ":" << categoryName(subcategory * kCategoriesPerSubcategory + category);
+        }
+        lines.push_back(line.str());
+    }
+    return lines;
+}
+
+// Every entry has a few categories known to the subcategories and a few that aren't
+static std::vector<xdg::DesktopEntry> desktopEntries(size_t subcategory_count)
+{
+    std::vector<xdg::DesktopEntry> entries;
+    size_t known_categories = subcategory_count * kCategoriesPerSubcategory;
+    srand(42);
+
+    for (size_t number = 0; number < kEntryCount; ++number) {
+        std::stringstream name, categories;
+        name << "Name=Application " << number;
+        categories << "Categories=GTK;Application;"
+                   << categoryName(rand() % known_categories) << ";"
+                   << categoryName(rand() % known_categories) << ";";
+
+        std::vector<std::string> lines;
+        lines.push_back("[Desktop Entry]");
+        lines.push_back(name.str());
+        lines.push_back("Icon=application");
+        lines.push_back("Exec=application %U");
+        lines.push_back(categories.str());
+
+        xdg::DesktopEntry entry;
+        entry.parse(lines);
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+static double classifyMilliseconds(ClassificationType classification_type, const std::vector<std::string> &category_lines, const std::vector<xdg::DesktopEntry> &entries)
+{
+    double total = 0;
+
+    for (size_t round = 0; round < kRounds; ++round) {
+        Menu menu;
+        menu.registerClassificationType(classification_type);
+        menu.loadCustomCategories(category_lines);
+
+        timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (std::vector<xdg::DesktopEntry>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+            menu.classify(*entry);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        total += elapsedMilliseconds(start, end);
+    }
+
+    return total / kRounds;
+}
+
+static void run(size_t subcategory_count)
+{
+    std::vector<std::string> category_lines = categoryLines(subcategory_count);
+    std::vector<xdg::DesktopEntry> entries = desktopEntries(subcategory_count);
+
+    double linear = classifyMilliseconds(LINEAR_CLASSIFICATION, category_lines, entries);
+    double indexed = classifyMilliseconds(INDEXED_CLASSIFICATION, category_lines, entries);
+    printf("%12lu %10lu %14.3f %14.3f\n", (unsigned long) subcategory_count, (unsigned long) entries.size(), linear, indexed);
+}
+
+} // namespace bench
+} // namespace amm
+
+int main()
+{
+    printf("%12s %10s %14s %14s\n", "subcategories", "entries", "linear (ms)", "indexed (ms)");
+    amm::bench::run(11);
+    amm::bench::run(50);
+    amm::bench::run(250);
+    amm::bench::run(1000);
+    return 0;
+}
@@ -0,0 +1,225 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "corpus.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "filex.h"
+#include "directoryx.h"
+
+namespace amm {
+namespace bench {
+
+static const char *kLanguages[] = {
+    "af", "ar", "ast", "be", "bg", "bn", "br", "bs", "ca", "ca@valencia", "cs", "cy", "da", "de", "el", "en_AU",
+    "en_CA", "en_GB", "eo", "es", "et", "eu", "fa", "fi", "fr", "fur", "ga", "gd", "gl", "gu", "he", "hi",
+    "hr", "hu", "ia", "id", "is", "it", "ja", "ka", "kk", "km", "kn", "ko", "lt", "lv", "mk", "ml",
+    "mr", "ms", "nb", "ne", "nl", "nn", "oc", "pa", "pl", "pt", "pt_BR", "ro", "ru", "si", "sk", "sl",
+    "sr", "sr@latin", "sv", "ta", "te", "tg", "th", "tr", "ug", "uk", "vi", "zh_CN", "zh_HK", "zh_TW"
+};
+static const size_t kLanguageCount = sizeof(kLanguages) / sizeof(kLanguages[0]);
+
+static const char *kCategories[] = {
+    "AudioVideo;Audio;Player;", "AudioVideo;Video;Player;", "Development;IDE;", "Development;Debugger;",
+    "Education;Science;Math;", "Game;ArcadeGame;", "Game;BoardGame;", "Graphics;2DGraphics;RasterGraphics;",
+    "Graphics;Viewer;", "Network;WebBrowser;", "Network;Email;", "Network;InstantMessaging;",
+    "Office;WordProcessor;", "Office;Spreadsheet;", "Settings;DesktopSettings;", "System;TerminalEmulator;",
+    "System;Monitor;", "Utility;Archiving;Compression;", "Utility;TextEditor;", "X-Vendor;X-Unknown;"
+};
+static const size_t kCategoryCount = sizeof(kCategories) / sizeof(kCategories[0]);
+
+static const char *kSizes[] = {"16x16", "22x22", "24x24", "32x32", "48x48", "64x64", "128x128", "256x256", "scalable"};
+static const size_t kSizeCount = sizeof(kSizes) / sizeof(kSizes[0]);
+
+static const char *kContexts[] = {"apps", "categories", "devices", "mimetypes", "places", "status", "actions"};
+static const size_t kContextCount = sizeof(kContexts) / sizeof(kContexts[0]);
+
+// Every tenth desktop file lives in a vendor subdirectory, like kde4/ in /usr/share/applications
+static const size_t kVendorEvery = 10;
+static const size_t kEntriesPerVendor = 1000;
+
+Corpus::Corpus(const std::string &root, size_t entry_count, size_t icon_count)
+    : root_(root), entry_count_(entry_count), icon_count_(icon_count), state_(20160101)
+{
+}
+
+// A linear congruential generator, so the corpus doesn't depend on the rand() of the C library
+uint32_t Corpus::next()
+{
+    state_ = state_ * 1664525u + 1013904223u;
+    return state_ >> 8;
+}
+
+// Most desktop files carry a handful of translations, desktop environments' own carry most languages
+size_t Corpus::translationCount()
+{
+    size_t bucket = below(100);
+    if (bucket < 50) {
+        return below(4);
+    }
+    if (bucket < 85) {
+        return 10 + below(30);
+    }
+    return kLanguageCount - below(10);
+}
+
+std::string Corpus::desktopEntry(size_t number)
+{
+    std::stringstream stream;
+    size_t translations = translationCount();
+
+    stream << "[Desktop Entry]\n";
+    stream << "Version=1.0\n";
+    stream << "Type=Application\n";
+    stream << "Name=Application " << number << "\n";
+    for (size_t language = 0; language < translations; ++language) {
+        stream << "Name[" << kLanguages[language] << "]=Application " << number << " (" << kLanguages[language] << ")\n";
+    }
+    stream << "GenericName=Tool\n";
+    for (size_t language = 0; language < translations; ++language) {
+        stream << "GenericName[" << kLanguages[language] << "]=Tool (" << kLanguages[language] << ")\n";
+    }
+    stream << "Comment=Does task number " << number << " & more\n";
+    for (size_t language = 0; language < translations; ++language) {
+        stream << "Comment[" << kLanguages[language] << "]=Does task number " << number << " (" << kLanguages[language] << ")\n";
+    }
+    stream << "Keywords=benchmark;tool;" << number << ";\n";
+    stream << "Exec=application-" << number << " --new-window %U\n";
+    stream << "TryExec=application-" << number << "\n";
+
+    // A fifth of the icons is missing from the theme, so the fallback search is exercised too
+    size_t icon = below(icon_count_ + icon_count_ / 4 + 1);
+    if (below(20) == 0) {
+        stream << "Icon=/opt/application-" << number << "/icon.png\n";
+    } else {
+        stream << "Icon=bench-icon-" << icon << "\n";
+    }
+    stream << "Terminal=false\n";
+    stream << "StartupNotify=true\n";
+    stream << "Categories=" << kCategories[below(kCategoryCount)] << "\n";
+    if (below(3) == 0) {
+        stream << "MimeType=application/x-bench-" << number << ";text/plain;\n";
+    }
+    if (below(50) == 0) {
+        stream << "NoDisplay=true\n";
+    }
+    if (below(5) == 0) {
+        stream << "Actions=new-window;\n\n";
+        stream << "[Desktop Action new-window]\n";
+        stream << "Name=New Window\n";
+        for (size_t language = 0; language < translations; ++language) {
+            stream << "Name[" << kLanguages[language] << "]=New Window (" << kLanguages[language] << ")\n";
+        }
+        stream << "Exec=application-" << number << " --new-window\n";
+    }
+    return stream.str();
+}
+
+void Corpus::writeDesktopEntries()
+{
+    mkdir(root_.c_str(), 0755);
+    mkdir(applicationDirectory().c_str(), 0755);
+
+    for (size_t number = 0; number < entry_count_; ++number) {
+        std::stringstream name;
+        name << applicationDirectory() << "/";
+        if (number % kVendorEvery == 0) {
+            name << "vendor-" << number / kEntriesPerVendor;
+            mkdir(name.str().c_str(), 0755);
+            name << "/";
+        }
+        name << "application-" << number << ".desktop";
+        FileX(name.str()).write(desktopEntry(number));
+    }
+}
+
+// Subdirectories go through sizes first, then contexts, and every icon is present in two of them
+void Corpus::writeIconTheme(size_t subdirectory_count)
+{
+    std::string icons = root_ + "/icons";
+    std::string theme = icons + "/" + iconThemeName();
+    mkdir(root_.c_str(), 0755);
+    mkdir(icons.c_str(), 0755);
+    mkdir(theme.c_str(), 0755);
+
+    std::vector<std::string> subdirectories;
+    for (size_t position = 0; position < subdirectory_count; ++position) {
+        std::string size = kSizes[position % kSizeCount];
+        std::string context = kContexts[(position / kSizeCount) % kContextCount];
+        subdirectories.push_back(size + "/" + context);
+        mkdir((theme + "/" + size).c_str(), 0755);
+        mkdir((theme + "/" + size + "/" + context).c_str(), 0755);
+    }
+
+    std::stringstream index;
+    index << "[Icon Theme]\nName=" << iconThemeName() << "\nComment=Synthetic theme\nInherits=hicolor\nDirectories=";
+    for (std::vector<std::string>::const_iterator subdirectory = subdirectories.begin(); subdirectory != subdirectories.end(); ++subdirectory) {
+        index << (subdirectory == subdirectories.begin() ? "" : ",") << *subdirectory;
+    }
+    index << "\n";
+    for (std::vector<std::string>::const_iterator subdirectory = subdirectories.begin(); subdirectory != subdirectories.end(); ++subdirectory) {
+        index << "\n[" << *subdirectory << "]\n";
+        if (subdirectory->compare(0, 8, "scalable") == 0) {
+            index << "Size=48\nMinSize=16\nMaxSize=512\nType=Scalable\n";
+        } else {
+            index << "Size=" << atoi(subdirectory->c_str()) << "\nType=Fixed\n";
+        }
+    }
+    FileX(theme + "/index.theme").write(index.str());
+
+    for (size_t icon = 0; icon < icon_count_; ++icon) {
+        std::stringstream name;
+        name << "bench-icon-" << icon << ".png";
+        FileX(theme + "/" + subdirectories[icon % subdirectory_count] + "/" + name.str()).write("");
+        FileX(theme + "/" + subdirectories[(icon * 7 + 3) % subdirectory_count] + "/" + name.str()).write("");
+    }
+}
+
+static void removeTree(const std::string &path)
+{
+    DirectoryX::Entries entries = DirectoryX(path).allEntries();
+    for (DirectoryX::Entries::iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+        std::string name = entry->name();
+        if (name == "." || name == "..") {
+            continue;
+        }
+        std::string full_path = path + "/" + name;
+        if (entry->isDirectory()) {
+            removeTree(full_path);
+        } else {
+            std::remove(full_path.c_str());
+        }
+    }
+    rmdir(path.c_str());
+}
+
+void Corpus::remove() const
+{
+    removeTree(root_);
+}
+
+} // namespace bench
+} // namespace amm
@@ -0,0 +1,56 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_BENCH_CORPUS_H_
+#define AMM_BENCH_CORPUS_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace amm {
+namespace bench {
+// Understands writing a reproducible set of desktop files and an icon theme for them
+// The same seed always gives the same files, so runs on different machines compare
+class Corpus
+{
+public:
+    Corpus(const std::string &root, size_t entry_count, size_t icon_count);
+    void writeDesktopEntries();
+    void writeIconTheme(size_t subdirectory_count);
+    void remove() const;
+
+    std::string root() const { return root_; }
+    std::string applicationDirectory() const { return root_ + "/applications"; }
+    std::string iconThemeName() const { return "Benchmark"; }
+
+private:
+    std::string root_;
+    size_t entry_count_;
+    size_t icon_count_;
+    uint32_t state_;
+
+    uint32_t next();
+    size_t below(size_t limit) { return next() % limit; }
+    size_t translationCount();
+    std::string desktopEntry(size_t number);
+};
+} // namespace bench
+} // namespace amm
+
+#endif // AMM_BENCH_CORPUS_H_
@@ -0,0 +1,46 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Writes a synthetic corpus, to run mjwm itself against it:
+//   corpus_generator DIRECTORY ENTRIES [SUBDIRECTORIES [ICONS]]
+//   XDG_DATA_DIRS=DIRECTORY HOME=DIRECTORY mjwm --iconize=Benchmark
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "corpus.h"
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s DIRECTORY ENTRIES [SUBDIRECTORIES [ICONS]]\n", argv[0]);
+        return 2;
+    }
+    size_t entry_count = strtoul(argv[2], NULL, 10);
+    size_t subdirectory_count = argc > 3 ? strtoul(argv[3], NULL, 10) : 24;
+    size_t icon_count = argc > 4 ? strtoul(argv[4], NULL, 10) : entry_count;
+    if (entry_count == 0 || subdirectory_count == 0) {
+        fprintf(stderr, "ENTRIES and SUBDIRECTORIES must be positive numbers\n");
+        return 2;
+    }
+
+    amm::bench::Corpus corpus(argv[1], entry_count, icon_count);
+    corpus.writeIconTheme(subdirectory_count);
+    corpus.writeDesktopEntries();
+    return 0;
+}
@@ -0,0 +1,234 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Compares the stringstream based JWM transformation with appending into a reusable buffer
+
+#include <time.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "stringx.h"
+#include "vectorx.h"
+#include "transformer/jwm.h"
+#include "representation/menu_start.h"
+#include "representation/menu_end.h"
+#include "representation/subcategory_start.h"
+#include "representation/subcategory_end.h"
+#include "representation/program.h"
+
+namespace amm {
+namespace bench {
+
+static const size_t kProgramCount = 5000;
+static const size_t kSubcategoryCount = 12;
+static const size_t kRounds = 50;
+
+static double elapsedMilliseconds(const timespec &start, const timespec &end)
+{
+    return (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1000000.0;
+}
+
+// The transformation as it was before appending, kept here as the baseline
+class StringstreamJwm : public transformer::TransformerInterface
+{
+public:
+    std::string transform(const representation::MenuStart &entry) const
+    {
+        std::stringstream stream;
+        stream << "<JWM>" << std::endl << "    <!--" << entry.name() << "-->";
+        return stream.str();
+    }
+
+    std::string transform(const representation::MenuEnd &entry) const
+    {
+        std::stringstream stream;
+        stream << "    <!--" << entry.name() << "-->" << std::endl << "</JWM>";
+        return stream.str();
+    }
+
+    std::string transform(const representation::SubcategoryStart &entry) const
+    {
+        std::stringstream stream;
+        stream << "    <Menu " << "label=\"" << StringX(entry.name()).encode() << "\" icon=\"" << entry.icon() << "\">";
+        return stream.str();
+    }
+
+    std::string transform(const representation::SubcategoryEnd &entry) const
+    {
+        std::stringstream stream;
+        stream << "        <!--" << entry.name() << "-->" << std::endl << "    </Menu>";
+        return stream.str();
+    }
+
+    std::string transform(const representation::Program &entry) const
+    {
+        std::stringstream stream;
+        stream << "        <Program " << "label=\"" << StringX(entry.name()).encode()
+               << "\" icon=\"" << StringX(entry.icon()).encode() << "\">"
+               << removeFieldCode(entry.executable()) << "</Program>";
+        return stream.str();
+    }
+
+private:
+    static std::string removeFieldCode(const std::string &input)
+    {
+        std::vector<std::string> result;
+        std::vector<std::string> tokens = StringX(input).split(" ");
+        for (std::vector<std::string>::const_iterator iter = tokens.begin(); iter != tokens.end(); ++iter) {
+            if (!(iter->size() >= 1 && (*iter)[0] == '%')) {
+                result.push_back(*iter);
+            }
+        }
+        return VectorX(result).join(" ");
+    }
+};
+
+// Appends every representation to a buffer, one line each
+class BufferVisitor
+{
+public:
+    BufferVisitor(const transformer::Jwm &jwm, std::string *buffer) : jwm_(jwm), buffer_(buffer) {}
+
+    template<class T> void operator()(const T &entry)
+    {
+        jwm_.append(entry, buffer_);
+        buffer_->push_back('\n');
+    }
+
+private:
+    const transformer::Jwm &jwm_;
+    std::string *buffer_;
+};
+
+struct SyntheticMenu
+{
+    representation::MenuStart menu_start;
+    representation::MenuEnd menu_end;
+    std::vector<representation::SubcategoryStart> subcategory_starts;
+    std::vector<representation::SubcategoryEnd> subcategory_ends;
+    std::vector< std::vector<representation::Program> > programs;
+};
+
+static void build(SyntheticMenu *menu)
+{
+    for (size_t subcategory = 0; subcategory < kSubcategoryCount; ++subcategory) {
+        std::stringstream name;
+        name << "Subcategory & " << subcategory;
+        menu->subcategory_starts.push_back(representation::SubcategoryStart(name.str(), "applications-other"));
+        menu->subcategory_ends.push_back(representation::SubcategoryEnd(name.str()));
+        menu->programs.push_back(std::vector<representation::Program>());
+    }
+
+    for (size_t number = 0; number < kProgramCount; ++number) {
+        std::stringstream name, icon, executable;
+        name << "Application <" << number << ">";
+        icon << "/usr/share/icons/hicolor/48x48/apps/application-" << number << ".png";
+        executable << "/usr/bin/application-" << number << " --new-window %U";
+        menu->programs[number % kSubcategoryCount].push_back(representation::Program(name.str(), icon.str(), executable.str(), "Comment"));
+    }
+}
+
+template<class Visitor> static void walk(const SyntheticMenu &menu, Visitor &visitor)
+{
+    visitor(menu.menu_start);
+    for (size_t subcategory = 0; subcategory < menu.subcategory_starts.size(); ++subcategory) {
+        visitor(menu.subcategory_starts[subcategory]);
+        const std::vector<representation::Program> &programs = menu.programs[subcategory];
+        for (std::vector<representation::Program>::const_iterator program = programs.begin(); program != programs.end(); ++program) {
+            visitor(*program);
+        }
+        visitor(menu.subcategory_ends[subcategory]);
+    }
+    visitor(menu.menu_end);
+}
+
+// Collects the transformation of every representation as a line, the way the output was assembled before
+class LineVisitor
+{
+public:
+    LineVisitor(const transformer::TransformerInterface &transformer, std::vector<std::string> *lines) : transformer_(transformer), lines_(lines) {}
+
+    template<class T> void operator()(const T &entry) { lines_->push_back(transformer_.transform(entry)); }
+
+private:
+    const transformer::TransformerInterface &transformer_;
+    std::vector<std::string> *lines_;
+};
+
+static double linesMilliseconds(const SyntheticMenu &menu, const transformer::TransformerInterface &transformer, size_t *bytes)
+{
+    double total = 0;
+    for (size_t round = 0; round < kRounds; ++round) {
+        std::vector<std::string> lines;
+        LineVisitor visitor(transformer, &lines);
+
+        timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        walk(menu, visitor);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        total += elapsedMilliseconds(start, end);
+
+        *bytes = 0;
+        for (std::vector<std::string>::const_iterator line = lines.begin(); line != lines.end(); ++line) {
+            *bytes += line->size() + 1;
+        }
+    }
+    return total / kRounds;
+}
+
+static double bufferMilliseconds(const SyntheticMenu &menu, size_t *bytes)
+{
+    transformer::Jwm jwm;
+    std::string buffer;
+    double total = 0;
+
+    for (size_t round = 0; round < kRounds; ++round) {
+        buffer.clear();
+        BufferVisitor visitor(jwm, &buffer);
+
+        timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        walk(menu, visitor);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        total += elapsedMilliseconds(start, end);
+    }
+    *bytes = buffer.size();
+    return total / kRounds;
+}
+
+} // namespace bench
+} // namespace amm
+
+int main()
+{
+    amm::bench::SyntheticMenu menu;
+    amm::bench::build(&menu);
+
+    size_t stringstream_bytes = 0, transform_bytes = 0, buffer_bytes = 0;
+    double stringstream_time = amm::bench::linesMilliseconds(menu, amm::bench::StringstreamJwm(), &stringstream_bytes);
+    double transform_time = amm::bench::linesMilliseconds(menu, amm::transformer::Jwm(), &transform_bytes);
+    double buffer_time = amm::bench::bufferMilliseconds(menu, &buffer_bytes);
+
+    printf("%-34s %10s %12s\n", "transformation", "bytes", "time (ms)");
+    printf("%-34s %10lu %12.3f\n", "stringstream, line per node", (unsigned long) stringstream_bytes, stringstream_time);
+    printf("%-34s %10lu %12.3f\n", "Jwm::transform, line per node", (unsigned long) transform_bytes, transform_time);
+    printf("%-34s %10lu %12.3f\n", "Jwm::append, reused buffer", (unsigned long) buffer_bytes, buffer_time);
+    return stringstream_bytes == buffer_bytes && transform_bytes == buffer_bytes ? 0 : 1;
+}
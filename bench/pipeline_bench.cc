@@ -0,0 +1,259 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Times every stage of the pipeline on synthetic corpora and prints the results as JSON
+//   pipeline_bench [ENTRIES...]
+// The corpus is written just before it is read, so discovery and parsing run against a warm page cache
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "corpus.h"
+#include "timex.h"
+#include "filex.h"
+#include "menu.h"
+#include "subcategory.h"
+#include "system_environment.h"
+#include "desktop_entry_file_search.h"
+#include "qualified_icon_theme.h"
+#include "icon_search/xdg_search.h"
+#include "icon_search/caching_search.h"
+#include "transformer/jwm_stream.h"
+#include "xdg/desktop_entry.h"
+#include "xdg/locale.h"
+
+namespace amm {
+namespace bench {
+
+static const size_t kIconThemeSubdirectories = 24;
+static const size_t kMaximumRounds = 20;
+
+static bool first_result = true;
+
+// Small corpora are run several times so that their numbers aren't noise
+static size_t roundsFor(size_t entry_count)
+{
+    size_t rounds = 10000 / entry_count;
+    if (rounds < 1) {
+        return 1;
+    }
+    return rounds < kMaximumRounds ? rounds : kMaximumRounds;
+}
+
+static void report(const std::string &stage, size_t entry_count, size_t rounds, double total_milliseconds)
+{
+    double milliseconds = total_milliseconds / rounds;
+    printf("%s{\"stage\":\"%s\",\"entries\":%lu,\"rounds\":%lu,\"milliseconds\":%.3f,\"microseconds_per_entry\":%.3f}",
+           first_result ? "" : ",\n", stage.c_str(), (unsigned long) entry_count, (unsigned long) rounds,
+           milliseconds, milliseconds * 1000 / entry_count);
+    first_result = false;
+    fflush(stdout);
+}
+
+static std::vector<std::string> defaultCategoryLines()
+{
+    std::vector<std::string> lines;
+    for (size_t position = 0; position < Subcategory::DefaultCount(); ++position) {
+        Subcategory subcategory = Subcategory::Default(position);
+        std::string line = subcategory.displayName() + ":" + subcategory.iconName();
+        const std::vector<std::string> &names = subcategory.classificationNames();
+        for (std::vector<std::string>::const_iterator name = names.begin(); name != names.end(); ++name) {
+            line += ":" + *name;
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static std::vector<std::string> discover(const Corpus &corpus)
+{
+    std::vector<std::string> directory_names;
+    directory_names.push_back(corpus.applicationDirectory());
+    DesktopEntryFileSearch search;
+    search.registerDirectories(directory_names);
+    search.resolve();
+    return search.desktopEntryFileNames();
+}
+
+static std::vector<xdg::DesktopEntry> parse(const std::vector<std::string> &file_names)
+{
+    xdg::Locale locale("de_DE");
+    std::vector<xdg::DesktopEntry> entries;
+    entries.reserve(file_names.size());
+    for (std::vector<std::string>::const_iterator name = file_names.begin(); name != file_names.end(); ++name) {
+        std::vector<std::string> lines;
+        if (FileX(*name).readLines(&lines)) {
+            xdg::DesktopEntry entry;
+            entry.parse(lines, locale);
+            if (entry.display() && entry.isValid()) {
+                entries.push_back(entry);
+            }
+        }
+    }
+    return entries;
+}
+
+static void classify(Menu *menu, const std::vector<xdg::DesktopEntry> &entries)
+{
+    menu->loadCustomCategories(defaultCategoryLines());
+    for (std::vector<xdg::DesktopEntry>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+        menu->classify(*entry);
+    }
+}
+
+static void run(size_t entry_count)
+{
+    char root[] = "/tmp/mjwm-bench-XXXXXX";
+    if (mkdtemp(root) == NULL) {
+        fprintf(stderr, "Couldn't create a directory for the corpus\n");
+        exit(1);
+    }
+    Corpus corpus(root, entry_count, entry_count);
+    corpus.writeIconTheme(kIconThemeSubdirectories);
+    corpus.writeDesktopEntries();
+    setenv("HOME", root, 1);
+    setenv("XDG_DATA_HOME", root, 1);
+    setenv("XDG_DATA_DIRS", root, 1);
+
+    size_t rounds = roundsFor(entry_count);
+    double start;
+    double total;
+
+    std::vector<std::string> file_names;
+    total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        start = timex::monotonicMilliseconds();
+        file_names = discover(corpus);
+        total += timex::monotonicMilliseconds() - start;
+    }
+    report("discovery", entry_count, rounds, total);
+
+    std::vector<xdg::DesktopEntry> entries;
+    total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        start = timex::monotonicMilliseconds();
+        entries = parse(file_names);
+        total += timex::monotonicMilliseconds() - start;
+    }
+    report("parse", entry_count, rounds, total);
+
+    total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        Menu menu;
+        start = timex::monotonicMilliseconds();
+        classify(&menu, entries);
+        total += timex::monotonicMilliseconds() - start;
+    }
+    report("classify", entry_count, rounds, total);
+
+    // Each round starts with a cold icon cache, as every run of mjwm does
+    total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        start = timex::monotonicMilliseconds();
+        icon_search::XdgSearch actual_searcher(48, QualifiedIconTheme(SystemEnvironment(), corpus.iconThemeName()));
+        icon_search::CachingSearch searcher(actual_searcher);
+        for (std::vector<xdg::DesktopEntry>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+            searcher.resolvedName(entry->icon());
+        }
+        total += timex::monotonicMilliseconds() - start;
+    }
+    report("icon resolution", entry_count, rounds, total);
+
+    total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        Menu menu;
+        classify(&menu, entries);
+        start = timex::monotonicMilliseconds();
+        menu.sort();
+        total += timex::monotonicMilliseconds() - start;
+    }
+    report("sort", entry_count, rounds, total);
+
+    Menu menu;
+    classify(&menu, entries);
+    menu.sort();
+    total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        std::string output;
+        start = timex::monotonicMilliseconds();
+        transformer::JwmStream jwm_transformer(&output);
+        menu.stream(jwm_transformer);
+        total += timex::monotonicMilliseconds() - start;
+    }
+    report("output", entry_count, rounds, total);
+
+    // A dynamic menu is answered from a warm menu and icon cache, as a daemon holds them
+    icon_search::XdgSearch dynamic_searcher(48, QualifiedIconTheme(SystemEnvironment(), corpus.iconThemeName()));
+    Menu dynamic_menu;
+    dynamic_menu.registerIconService(*new icon_search::CachingSearch(dynamic_searcher));
+    classify(&dynamic_menu, entries);
+    dynamic_menu.sort();
+    std::string largest_subcategory_name;
+    size_t largest_subcategory_size = 0;
+    const std::vector<Subcategory> &subcategories = dynamic_menu.subcategories();
+    for (std::vector<Subcategory>::const_iterator subcategory = subcategories.begin(); subcategory != subcategories.end(); ++subcategory) {
+        if (subcategory->desktopEntryPositions().size() >= largest_subcategory_size) {
+            largest_subcategory_name = subcategory->displayName();
+            largest_subcategory_size = subcategory->desktopEntryPositions().size();
+        }
+    }
+    std::string warm_output;
+    transformer::JwmStream warm_transformer(&warm_output);
+    dynamic_menu.stream(warm_transformer);
+    total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        std::string output;
+        start = timex::monotonicMilliseconds();
+        transformer::JwmStream jwm_transformer(&output);
+        dynamic_menu.stream(jwm_transformer, largest_subcategory_name);
+        total += timex::monotonicMilliseconds() - start;
+    }
+    report("dynamic subcategory", entry_count, rounds, total);
+
+    corpus.remove();
+}
+
+} // namespace bench
+} // namespace amm
+
+int main(int argc, char *argv[])
+{
+    std::vector<size_t> entry_counts;
+    for (int position = 1; position < argc; ++position) {
+        size_t entry_count = strtoul(argv[position], NULL, 10);
+        if (entry_count > 0) {
+            entry_counts.push_back(entry_count);
+        }
+    }
+    if (entry_counts.empty()) {
+        entry_counts.push_back(100);
+        entry_counts.push_back(1000);
+        entry_counts.push_back(10000);
+        entry_counts.push_back(100000);
+    }
+
+    printf("{\"benchmarks\":[\n");
+    for (std::vector<size_t>::const_iterator entry_count = entry_counts.begin(); entry_count != entry_counts.end(); ++entry_count) {
+        amm::bench::run(*entry_count);
+    }
+    printf("\n]}\n");
+    return 0;
+}
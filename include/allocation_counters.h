@@ -0,0 +1,44 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_ALLOCATION_COUNTERS_H_
+#define AMM_ALLOCATION_COUNTERS_H_
+
+#include <string>
+
+namespace amm {
+// Understands how much heap memory the process asked for
+// Only programs linked with allocation_hooks.cc count; in the others every counter stays zero
+struct AllocationCounters
+{
+    size_t allocations;
+    size_t deallocations;
+    size_t allocated_bytes;
+    size_t live_bytes;
+    size_t peak_live_bytes;
+
+    void recordAllocation(size_t size);
+    void recordDeallocation(size_t size);
+    bool isCounting() const { return allocations > 0; }
+
+    static AllocationCounters &Process();
+    static size_t PeakResidentKilobytes();
+};
+} // namespace amm
+
+#endif // AMM_ALLOCATION_COUNTERS_H_
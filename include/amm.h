@@ -21,33 +21,78 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
 
 #include "amm_options.h"
 #include "system_environment.h"
 #include "menu.h"
+#include "desktop_entry_cache.h"
+#include "qualified_icon_theme.h"
+#include "timings.h"
+#include "trace.h"
+#include "local_socket.h"
 #include "icon_search/icon_search_interface.h"
+#include "icon_search/caching_search.h"
+#include "icon_search/xdg_search.h"
 
 namespace amm {
-class Amm
+class Amm : public LocalSocketResponder
 {
 public:
     Amm();
     ~Amm();
-    void validateEnvironment() const;
+    void validateEnvironment();
     void loadCommandLineOption(int argc, char **argv);
+    void runClient();
+    void runDaemon();
+    void runBatch();
     void registerIconService();
     void readCategories();
     void readDesktopEntryFiles();
+    void exitIfUnchanged();
     void populate();
+    void printDynamicMenu();
     void writeOutputFile();
+    void removeOldBackups();
     void printSummary() const;
+    void writeTrace() const;
 
 private:
+    Timings timings_;
+    Trace trace_;
     SystemEnvironment environment_;
     AmmOptions options_;
     Menu menu_;
+    std::vector<Menu*> translated_menus_;
     std::vector<std::string> desktop_entry_file_names_;
-    icon_search::IconSearchInterface *actual_searcher_;
+    std::vector<std::string> visited_directory_names_;
+    std::vector<std::string> shared_desktop_entry_file_names_;
+    DesktopEntryCache shared_entries_;
+    std::string fingerprint_;
+    icon_search::XdgSearch *actual_searcher_;
+    icon_search::CachingSearch *caching_searcher_;
+    std::set<std::string> unchanged_file_names_;
+    std::map<std::string, std::string> backup_file_names_;
+    std::map<std::string, size_t> removed_backups_;
+    std::map<std::string, std::string> daemon_outputs_;
+
+    std::vector<Menu*> menus();
+    std::vector<std::string> batchHomeNames() const;
+    void readSharedDesktopEntryFiles();
+    void readHomeDesktopEntryFiles(const SystemEnvironment &home_environment);
+    void createIconSearch(const QualifiedIconTheme &theme);
+    void registerIconSearch(icon_search::IconSearchInterface &icon_searcher);
+    std::string inputFingerprint() const;
+    std::string menuOutput(const Menu &menu, const std::string &subcategory_name) const;
+    void rebuildMenu(std::string *fingerprint);
+    virtual std::string answer(const std::string &subcategory_name);
+    bool populateMenus();
+    bool writeOutputFiles();
+    bool writeOutput(const std::string &output_file_name, const std::string &output);
+    void printOutputFile() const;
+    void printTimings() const;
+    void printReport(const std::string &status) const;
 };
 } // namespace amm
 
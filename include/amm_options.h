@@ -33,6 +33,9 @@ struct AmmOptions
     bool is_version;
     bool is_iconize;
     bool is_backup;
+    bool is_backup_limited;
+    size_t backups_to_keep;
+    bool is_if_changed;
     bool override_default_directories;
     std::string summary_type;
     std::string output_file_name;
@@ -41,8 +44,21 @@ struct AmmOptions
     std::string icon_theme_name;
     std::string language;
     std::vector<std::string> deprecations;
+    std::string timings_format;
+    std::string trace_file_name;
+    std::string report_format;
+    bool is_daemon;
+    bool is_client;
+    std::string socket_name;
+    bool is_dynamic;
+    std::string dynamic_subcategory_name;
+    std::string batch_file_name;
 
     bool hasValidSummaryType() const { return (summary_type == "normal" || summary_type == "long"); }
+    bool hasValidTimingsFormat() const { return (timings_format == "" || timings_format == "table" || timings_format == "json"); }
+    bool hasValidReportFormat() const { return (report_format == "" || report_format == "json"); }
+    std::vector<std::string> languages() const;
+    std::vector<std::string> outputFileNames() const;
 
     static AmmOptions Default(const std::string &home, const std::string &language);
 };
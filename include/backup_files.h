@@ -0,0 +1,43 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_BACKUP_FILES_H_
+#define AMM_BACKUP_FILES_H_
+
+#include <string>
+#include <vector>
+
+namespace amm {
+// Understands the timestamped backups (FILE.YYYYMMDDHHMMSS.bak) kept next to a file
+class BackupFiles
+{
+public:
+    explicit BackupFiles(const std::string &file_name);
+
+    std::vector<std::string> names() const;
+    size_t removeAllBut(size_t count) const;
+
+private:
+    std::string directory_name_;
+    std::string prefix_;
+
+    bool isBackupName(const std::string &name) const;
+};
+} // namespace amm
+
+#endif // AMM_BACKUP_FILES_H_
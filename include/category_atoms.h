@@ -0,0 +1,47 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_CATEGORY_ATOMS_H_
+#define AMM_CATEGORY_ATOMS_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "category_set.h"
+
+namespace amm {
+// Understands mapping category names to small integers, so that category sets can be compared as bitsets
+class CategoryAtoms
+{
+public:
+    size_t size() const { return names_.size(); }
+    std::string name(size_t atom) const { return names_[atom]; }
+
+    size_t intern(const std::string &name);
+    bool find(const std::string &name, size_t *atom) const;
+    CategorySet internAll(const std::vector<std::string> &names);
+    CategorySet knownOf(const std::vector<std::string> &names) const;
+
+private:
+    std::map<std::string, size_t> atoms_;
+    std::vector<std::string> names_;
+};
+} // namespace amm
+
+#endif // AMM_CATEGORY_ATOMS_H_
@@ -0,0 +1,40 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_CATEGORY_INDEX_H_
+#define AMM_CATEGORY_INDEX_H_
+
+#include <string>
+#include <vector>
+
+#include "category_atoms.h"
+
+namespace amm {
+// Understands which subcategories claim each interned category name
+class CategoryIndex
+{
+public:
+    void add(size_t atom, size_t subcategory_position);
+    void subcategoriesFor(const std::vector<std::string> &category_names, const CategoryAtoms &category_atoms, std::vector<size_t> *subcategory_positions) const;
+
+private:
+    std::vector< std::vector<size_t> > subcategories_by_atom_;
+};
+} // namespace amm
+
+#endif // AMM_CATEGORY_INDEX_H_
@@ -0,0 +1,42 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_CATEGORY_SET_H_
+#define AMM_CATEGORY_SET_H_
+
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+namespace amm {
+// Understands a set of interned category names stored as a bitset that grows as needed
+class CategorySet
+{
+public:
+    void insert(size_t atom);
+    bool contains(size_t atom) const;
+    bool intersects(const CategorySet &other) const;
+    bool empty() const;
+
+private:
+    static const size_t kBitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> words_;
+};
+} // namespace amm
+
+#endif // AMM_CATEGORY_SET_H_
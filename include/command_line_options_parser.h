@@ -31,6 +31,7 @@ public:
 
 private:
     void allowMultipleEntries() const;
+    bool parseCount(const std::string &text, size_t *count) const;
     std::string home_;
     std::string language_;
 };
@@ -0,0 +1,43 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_DESKTOP_ENTRY_CACHE_H_
+#define AMM_DESKTOP_ENTRY_CACHE_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "xdg/desktop_entry.h"
+#include "xdg/locale.h"
+
+namespace amm {
+// Understands desktop files read and parsed once, in each of several locales, for many menus to share
+class DesktopEntryCache
+{
+public:
+    void load(const std::vector<std::string> &file_names, const std::vector<xdg::Locale> &locales);
+    const std::vector<xdg::DesktopEntry> *find(const std::string &file_name) const;
+    size_t size() const { return entries_by_file_name_.size(); }
+
+private:
+    std::map< std::string, std::vector<xdg::DesktopEntry> > entries_by_file_name_;
+};
+} // namespace amm
+
+#endif // AMM_DESKTOP_ENTRY_CACHE_H_
@@ -30,8 +30,10 @@ public:
     void resolve();
     void registerDirectories(const std::vector<std::string> &directory_names) { directory_names_ = directory_names; }
     void registerDefaultDirectories();
+    void registerSystemDirectories();
     std::vector<std::string> desktopEntryFileNames() const { return desktop_file_names_; }
     std::vector<std::string> badPaths() const { return bad_paths_; }
+    std::vector<std::string> visitedDirectoryNames() const { return visited_directory_names_; }
 
 private:
     void populate(const std::string &directory_name);
@@ -39,6 +41,7 @@ private:
     std::vector<std::string> directory_names_;
     std::vector<std::string> desktop_file_names_;
     std::vector<std::string> bad_paths_;
+    std::vector<std::string> visited_directory_names_;
 };
 } // namespace amm
 
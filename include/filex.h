@@ -28,7 +28,10 @@ class FileX
 public:
     explicit FileX(const std::string &name) : name_(name) { }
     bool readLines(std::vector<std::string> *lines) const;
+    bool read(std::string *content) const;
     bool writeLines(const std::vector<std::string> &lines) const;
+    bool write(const std::string &content) const;
+    bool replaceWith(const std::string &content) const;
     bool moveTo(const std::string &location) const;
     bool exists() const;
     bool existsAsDirectory() const;
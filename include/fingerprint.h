@@ -0,0 +1,45 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_FINGERPRINT_H_
+#define AMM_FINGERPRINT_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace amm {
+// Understands a cheap digest of the inputs a menu is generated from
+class Fingerprint
+{
+public:
+    Fingerprint();
+    void addText(const std::string &text);
+    void addModificationTime(const std::string &path);
+    void addIconThemes(const std::vector<std::string> &theme_directories);
+    void addCollation();
+    std::string hex() const;
+
+private:
+    uint64_t hash_;
+
+    void addBytes(const char *bytes, size_t size);
+};
+} // namespace amm
+
+#endif // AMM_FINGERPRINT_H_
@@ -0,0 +1,49 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_HOME_OWNER_H_
+#define AMM_HOME_OWNER_H_
+
+#include <sys/types.h>
+#include <string>
+#include <vector>
+
+namespace amm {
+// Understands acting as the owner of a home directory for as long as it is in scope
+// Only root switches its effective user, group and supplementary groups; anyone else already acts as themselves
+class HomeOwner
+{
+public:
+    explicit HomeOwner(const std::string &home_name);
+    ~HomeOwner();
+    bool isAssumed() const { return is_assumed_; }
+
+private:
+    bool is_assumed_;
+    bool is_switched_;
+    uid_t saved_uid_;
+    gid_t saved_gid_;
+    std::vector<gid_t> saved_groups_;
+
+    void restore();
+    HomeOwner(const HomeOwner &);
+    HomeOwner &operator=(const HomeOwner &);
+};
+} // namespace amm
+
+#endif // AMM_HOME_OWNER_H_
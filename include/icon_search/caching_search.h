@@ -27,25 +27,42 @@
 namespace amm {
 namespace icon_search {
 // Understands reusing older searches for icon names
+// A lookup counts as resolved when the search finds a name other than the one it was given
 class CachingSearch : public IconSearchInterface
 {
 public:
-    explicit CachingSearch(IconSearchInterface &actual_searcher) : actual_searcher_(actual_searcher) { }
+    explicit CachingSearch(IconSearchInterface &actual_searcher) : actual_searcher_(actual_searcher), lookups_(0), cache_hits_(0), resolved_lookups_(0) { }
     std::string resolvedName(const std::string &icon_name) const
     {
+        ++lookups_;
         std::map<std::string, std::string>::const_iterator it = IteratorTo(icon_name);
         if (it != cache.end()) {
+            ++cache_hits_;
+            countResolved(icon_name, it->second);
             return it->second;
         }
         std::string result = actual_searcher_.resolvedName(icon_name);
         cache.insert(std::pair<std::string, std::string>(icon_name, result));
+        countResolved(icon_name, result);
         return result;
     }
 
     bool isCached(const std::string &icon_name) const { return IteratorTo(icon_name) != cache.end(); }
+    size_t lookups() const { return lookups_; }
+    size_t cacheHits() const { return cache_hits_; }
+    size_t resolvedLookups() const { return resolved_lookups_; }
 
 private:
     IconSearchInterface& actual_searcher_;
+    mutable size_t lookups_;
+    mutable size_t cache_hits_;
+    mutable size_t resolved_lookups_;
+    void countResolved(const std::string &icon_name, const std::string &result) const
+    {
+        if (result != icon_name) {
+            ++resolved_lookups_;
+        }
+    }
     mutable std::map<std::string, std::string> cache;
     std::map<std::string, std::string>::const_iterator IteratorTo(const std::string &icon_name) const { return cache.find(icon_name); }
 };
@@ -0,0 +1,50 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_ICON_SEARCH_LAYERED_SEARCH_H_
+#define AMM_ICON_SEARCH_LAYERED_SEARCH_H_
+
+#include <string>
+
+#include "icon_search/icon_search_interface.h"
+
+namespace amm {
+namespace icon_search {
+// Understands preferring the icons one search finds over those another search finds
+class LayeredSearch : public IconSearchInterface
+{
+public:
+    LayeredSearch(IconSearchInterface &preferred_searcher, IconSearchInterface &fallback_searcher)
+        : preferred_searcher_(preferred_searcher), fallback_searcher_(fallback_searcher) { }
+    std::string resolvedName(const std::string &icon_name) const
+    {
+        std::string result = preferred_searcher_.resolvedName(icon_name);
+        if (result != icon_name) {
+            return result;
+        }
+        return fallback_searcher_.resolvedName(icon_name);
+    }
+
+private:
+    IconSearchInterface &preferred_searcher_;
+    IconSearchInterface &fallback_searcher_;
+};
+} // namespace icon_search
+} // namespace amm
+
+#endif // AMM_ICON_SEARCH_LAYERED_SEARCH_H_
@@ -34,7 +34,9 @@ class XdgSearch : public IconSearchInterface
 {
 public:
     XdgSearch(int size, QualifiedIconTheme qualified_icon_theme);
+    XdgSearch(int size, const std::vector<std::string> &theme_search_paths, const std::vector<xdg::IconTheme> &icon_themes);
     std::string resolvedName(const std::string &icon_name) const;
+    const std::vector<xdg::IconTheme> &iconThemes() const { return icon_themes_; }
 
 private:
     int size_;
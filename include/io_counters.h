@@ -0,0 +1,41 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_IO_COUNTERS_H_
+#define AMM_IO_COUNTERS_H_
+
+#include <string>
+
+namespace amm {
+// Understands how much file-system work the process did
+struct IoCounters
+{
+    size_t stat_calls;
+    size_t open_calls;
+    size_t opendir_calls;
+    size_t readdir_calls;
+    size_t bytes_read;
+
+    void reset();
+    std::string details() const;
+
+    static IoCounters &Process();
+};
+} // namespace amm
+
+#endif // AMM_IO_COUNTERS_H_
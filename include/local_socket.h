@@ -0,0 +1,63 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_LOCAL_SOCKET_H_
+#define AMM_LOCAL_SOCKET_H_
+
+#include <string>
+
+namespace amm {
+// Understands answering one request received on a LocalSocket
+class LocalSocketResponder
+{
+public:
+    virtual ~LocalSocketResponder() {}
+    virtual std::string answer(const std::string &request) = 0;
+};
+
+// Understands a UNIX domain socket at a path, served by one process and requested by others
+// A client sends its whole request and stops writing; the server answers with its whole reply and closes the connection
+// Either side gives up on the other after kTimeoutMilliseconds without data
+class LocalSocket
+{
+public:
+    static const int kTimeoutMilliseconds = 500;
+
+    explicit LocalSocket(const std::string &path) : path_(path), descriptor_(-1) { }
+    ~LocalSocket();
+    bool hasValidPath() const;
+    bool listen();
+    bool waitForConnection(int timeout_milliseconds) const;
+    int accept() const;
+    bool answerConnection(LocalSocketResponder &responder) const;
+    bool request(const std::string &message, std::string *reply) const;
+
+    static bool writeAll(int descriptor, const std::string &content);
+    static bool readAll(int descriptor, std::string *content);
+
+private:
+    std::string path_;
+    int descriptor_;
+
+    bool connectTo(int descriptor) const;
+    LocalSocket(const LocalSocket &);
+    LocalSocket &operator=(const LocalSocket &);
+};
+} // namespace amm
+
+#endif // AMM_LOCAL_SOCKET_H_
@@ -0,0 +1,47 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_LOCAL_SOCKET_STANDBY_H_
+#define AMM_LOCAL_SOCKET_STANDBY_H_
+
+#include <sys/types.h>
+
+#include "local_socket.h"
+
+namespace amm {
+// Understands answering the clients of a served LocalSocket from a forked copy of the process while the process is busy
+// The copy answers as the process would have when the standby was created, and stops once the standby is gone
+class LocalSocketStandby
+{
+public:
+    static const int kStopCheckMilliseconds = 50;
+
+    LocalSocketStandby(const LocalSocket &socket, LocalSocketResponder &responder);
+    ~LocalSocketStandby();
+    bool isServing() const { return child_ > 0; }
+
+private:
+    pid_t child_;
+    int stop_descriptor_;
+
+    LocalSocketStandby(const LocalSocketStandby &);
+    LocalSocketStandby &operator=(const LocalSocketStandby &);
+};
+} // namespace amm
+
+#endif // AMM_LOCAL_SOCKET_STANDBY_H_
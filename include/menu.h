@@ -23,11 +23,24 @@
 #include <vector>
 
 #include "stats.h"
+#include "desktop_entry_cache.h"
+#include "category_atoms.h"
+#include "category_index.h"
 #include "subcategory.h"
+#include "timings.h"
+#include "xdg/locale.h"
 #include "icon_search/icon_search_interface.h"
 #include "representation/representation_interface.h"
+#include "transformer/stream_transformer_interface.h"
 
 namespace amm {
+
+enum ClassificationType
+{
+    LINEAR_CLASSIFICATION,
+    INDEXED_CLASSIFICATION
+};
+
 // Understands a collection of desktop files divided in subcategories
 // TODO : Split amm::Menu
 class Menu
@@ -37,24 +50,46 @@ public:
     ~Menu();
 
     void registerIconService(icon_search::IconSearchInterface &icon_searcher);
-    void registerLanguage(const std::string &language) { language_ = language; }
-    std::vector<Subcategory> subcategories() const { return subcategories_; }
-    Stats summary() const { return summary_; }
+    void registerLanguage(const std::string &language) { locale_ = xdg::Locale(language); }
+    void registerClassificationType(ClassificationType classification_type) { classification_type_ = classification_type; }
+    void registerTimings(Timings &timings) { timings_ = &timings; }
+    const std::vector<Subcategory> &subcategories() const { return subcategories_; }
+    const std::vector<xdg::DesktopEntry> &desktopEntries() const { return desktop_entries_; }
+    std::vector<xdg::DesktopEntry> desktopEntriesOf(const Subcategory &subcategory) const;
+    const Stats &summary() const { return summary_; }
+    void retainSummaryDetails() { summary_.retainDetails(); }
 
     void loadCustomCategories(const std::vector<std::string> &lines);
     void populate(const std::vector<std::string> &desktop_file_names);
+    static void PopulateAll(const std::vector<Menu*> &menus, const std::vector<std::string> &desktop_file_names);
+    static void PopulateAll(const std::vector<Menu*> &menus, const std::vector<std::string> &desktop_file_names, const DesktopEntryCache &shared_entries);
+    void clear();
     void sort();
+    bool classify(const xdg::DesktopEntry &entry);
     std::vector<representation::RepresentationInterface*> representations() const;
+    void stream(transformer::StreamTransformerInterface &transformer) const;
+    void stream(transformer::StreamTransformerInterface &transformer, const std::string &subcategory_name) const;
 
 private:
-    void addDesktopEntry(const std::string &desktop_entry_name);
-    bool classify(const xdg::DesktopEntry &entry);
+    void startPopulating();
+    void finishPopulating();
+    void addDesktopEntry(const std::string &desktop_entry_name, const xdg::DesktopEntry &entry);
+    void matchByScan(const xdg::DesktopEntry &entry);
+    void matchByIndex(const xdg::DesktopEntry &entry);
     void createDefaultCategories();
+    void addSubcategory(const Subcategory &subcategory);
 
-    std::string language_;
+    xdg::Locale locale_;
     icon_search::IconSearchInterface *icon_searcher_;
     Subcategory unclassified_subcategory_;
     std::vector<Subcategory> subcategories_;
+    std::vector<xdg::DesktopEntry> desktop_entries_;
+    CategoryAtoms category_atoms_;
+    CategoryIndex category_index_;
+    ClassificationType classification_type_;
+    bool has_categories_;
+    Timings *timings_;
+    std::vector<size_t> matching_subcategories_;
     std::vector<std::string> desktop_file_names_;
     Stats summary_;
 };
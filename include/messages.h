@@ -30,6 +30,8 @@ std::string version();
 std::string homeNotSet();
 std::string optionError();
 std::string badSummaryType(const std::string &actual);
+std::string badTimingsFormat(const std::string &actual);
+std::string badReportFormat(const std::string &actual);
 std::string badInputPaths(const std::string &bad_paths);
 std::string autogeneratedByAmm();
 std::string noValidDesktopEntryFiles();
@@ -37,6 +39,23 @@ std::string badCategoryFile(const std::string &file_name);
 std::string outputPathBlockedByDirectory(const std::string &file_name);
 std::string badOutputFile(const std::string &file_name);
 std::string backupFile(const std::string &file_name, const std::string &backup_file_name);
+std::string badBackupFile(const std::string &backup_file_name);
+std::string badTraceFile(const std::string &file_name);
+std::string removedBackupFiles(const std::string &file_name, size_t count);
+std::string createdOutputFile(const std::string &file_name);
+std::string unchangedOutputFile(const std::string &file_name);
+std::string fingerprintOf(const std::string &digest);
+std::string unchangedInputs(const std::string &file_name);
+std::string daemonWithClient();
+std::string daemonWithRunReports();
+std::string badSocket(const std::string &socket_name);
+std::string servingMenus(const std::string &socket_name);
+std::string noDaemon(const std::string &socket_name);
+std::string languagesWithSingleMenuOptions();
+std::string batchWithSingleRunOptions();
+std::string badBatchFile(const std::string &file_name);
+std::string badHomeOwner(const std::string &home_name);
+std::string skippedHome(const std::string &home_name);
 
 } // namespace messages
 } // namespace amm
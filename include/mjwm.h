@@ -0,0 +1,44 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_MJWM_H_
+#define AMM_MJWM_H_
+
+// The API of libmjwm, for generating JWM menus without running mjwm
+// Compile with -I$(includedir)/mjwm and link with -lmjwm
+//
+// DesktopEntryFileSearch finds desktop files, Menu parses and classifies them
+// and streams itself through a transformer such as transformer::JwmStream.
+// A Menu can be kept after populating it; streaming it again parses no
+// desktop file. Icons are resolved by an icon_search::XdgSearch, best wrapped
+// in an icon_search::CachingSearch; a Menu owns the search registered with it.
+
+#include "system_environment.h"
+#include "desktop_entry_file_search.h"
+#include "desktop_entry_cache.h"
+#include "qualified_icon_theme.h"
+#include "menu.h"
+#include "stats.h"
+#include "icon_search/icon_search_interface.h"
+#include "icon_search/xdg_search.h"
+#include "icon_search/caching_search.h"
+#include "icon_search/mirror_search.h"
+#include "transformer/stream_transformer_interface.h"
+#include "transformer/jwm_stream.h"
+
+#endif // AMM_MJWM_H_
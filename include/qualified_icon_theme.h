@@ -32,12 +32,14 @@ class QualifiedIconTheme
 {
 public:
     QualifiedIconTheme(const SystemEnvironment &environment, const std::string &theme_name);
+    QualifiedIconTheme(const std::vector<std::string> &theme_directories, const std::string &theme_name);
     std::vector<std::string> themeSearchPaths() { return theme_search_paths_; }
     std::vector<xdg::IconTheme> themeWithParent();
 
 private:
     std::string theme_name_;
     std::vector<std::string> theme_search_paths_;
+    void registerExistingDirectories(const std::vector<std::string> &theme_directories);
     xdg::IconTheme currentIconThemeFromName();
     xdg::IconTheme iconThemeFromName(const std::string &theme_name);
 };
@@ -0,0 +1,55 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_REPORT_H_
+#define AMM_REPORT_H_
+
+#include <string>
+#include <vector>
+
+#include "stats.h"
+#include "timings.h"
+
+namespace amm {
+// Understands the outcome of a run as one JSON document, for collecting across many runs
+class Report
+{
+public:
+    Report(const std::string &version, const Stats &summary, const Timings &timings);
+    void registerOutput(const std::string &file_name, const std::string &status, const std::string &backup_file_name, size_t removed_backups);
+    void registerIconLookups(size_t lookups, size_t cache_hits, size_t resolved_lookups);
+    void addCategory(const std::string &name, size_t entries);
+    std::string json() const;
+
+private:
+    std::string version_;
+    const Stats &summary_;
+    const Timings &timings_;
+    std::string output_file_name_;
+    std::string output_status_;
+    std::string backup_file_name_;
+    size_t removed_backups_;
+    size_t icon_lookups_;
+    size_t icon_cache_hits_;
+    size_t resolved_icon_lookups_;
+    std::vector<std::string> category_names_;
+    std::vector<size_t> category_entries_;
+};
+} // namespace amm
+
+#endif // AMM_REPORT_H_
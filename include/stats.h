@@ -19,17 +19,23 @@
 #ifndef AMM_STATS_H_
 #define AMM_STATS_H_
 
+#include <set>
 #include <string>
 #include <vector>
 
 namespace amm {
 // Understands the summary of populating a menu
+// Only the counts are kept, unless the details are asked for; unparsed files are always listed
 class Stats
 {
 public:
-    void addClassifiedFile(const std::string &file) { classified_files_.push_back(file); }
-    void addUnclassifiedFile(const std::string &file) { unclassified_files_.push_back(file); }
-    void addSuppressedFile(const std::string &file) { suppressed_files_.push_back(file); }
+    Stats() : classified_count_(0), unclassified_count_(0), suppressed_count_(0), is_detailed_(false) { }
+    void retainDetails() { is_detailed_ = true; }
+    bool isDetailed() const { return is_detailed_; }
+
+    void addClassifiedFile(const std::string &file);
+    void addUnclassifiedFile(const std::string &file);
+    void addSuppressedFile(const std::string &file);
     void addUnparsedFile(const std::string &file) { unparsed_files_.push_back(file); }
     void addUnhandledClassifications(const std::vector<std::string> &classifications);
 
@@ -38,17 +44,22 @@ public:
     size_t totalUnclassifiedFiles() const;
     size_t totalSuppressedFiles() const;
     size_t totalUnparsedFiles() const;
-    std::vector<std::string> unparsedFiles() const;
-    std::vector<std::string> unhandledClassifications();
+    std::vector<std::string> unparsedFiles() const { return unparsed_files_; }
+    std::vector<std::string> suppressedFiles() const { return suppressed_files_; }
+    std::vector<std::string> unclassifiedFiles() const { return unclassified_files_; }
+    std::vector<std::string> unhandledClassifications() const;
 
-    std::string details(const std::string &summary_type);
+    std::string details(const std::string &summary_type) const;
 
 private:
-    std::vector<std::string> classified_files_;
+    size_t classified_count_;
+    size_t unclassified_count_;
+    size_t suppressed_count_;
+    bool is_detailed_;
     std::vector<std::string> unclassified_files_;
     std::vector<std::string> unparsed_files_;
     std::vector<std::string> suppressed_files_;
-    std::vector<std::string> unhandled_classifications_;
+    std::set<std::string> unhandled_classifications_;
 };
 } // namespace amm
 
@@ -31,7 +31,11 @@ public:
     bool endsWith(const std::string &delimiter) const;
     std::string terminateWith(const std::string &end) const;
     std::string encode() const;
+    void appendEncodedTo(std::string *buffer) const;
+    static void appendEncoded(const std::string &string, std::string *buffer);
+    std::string jsonQuoted() const;
     std::string trim() const;
+    std::string collationKey() const;
     std::vector<std::string> split(const std::string &delimiter) const;
 private:
     const std::string string_;
@@ -23,9 +23,12 @@
 #include <vector>
 
 #include "xdg/desktop_entry.h"
+#include "category_atoms.h"
+#include "category_set.h"
 
 namespace amm {
 // Understands a collection of desktop files belonging to the same category
+// The desktop files themselves live in a pool owned elsewhere, a subcategory only knows their positions in it
 class Subcategory
 {
 public:
@@ -35,31 +38,25 @@ public:
 
     std::string displayName() const { return display_name_; }
     std::string iconName() const { return icon_name_; }
-    std::vector<std::string> classificationNames() const { return classification_names_; }
-    std::vector<xdg::DesktopEntry> desktopEntries() const { return desktop_entries_; }
+    const std::vector<std::string> &classificationNames() const { return classification_names_; }
+    const std::vector<size_t> &desktopEntryPositions() const { return desktop_entry_positions_; }
 
-    bool hasEntries() const;
-    void addDesktopEntry(const xdg::DesktopEntry &desktop_file);
-    void sortDesktopEntries();
+    bool hasEntries() const { return !desktop_entry_positions_.empty(); }
+    void internClassificationNames(CategoryAtoms &category_atoms) { classifications_ = category_atoms.internAll(classification_names_); }
+    bool classifies(const CategorySet &categories) const { return classifications_.intersects(categories); }
+    void addDesktopEntry(size_t desktop_entry_position) { desktop_entry_positions_.push_back(desktop_entry_position); }
+    void sortDesktopEntries(const std::vector<std::string> &collation_keys);
 
-    static Subcategory Others()      { return Subcategory("Others",      "applications-others",      "Others"     ); }
-    static Subcategory Settings()    { return Subcategory("Settings",    "gnome-settings",           "Settings"   ); }
-    static Subcategory Accessories() { return Subcategory("Accessories", "applications-accessories", "Utility"    ); }
-    static Subcategory Development() { return Subcategory("Development", "applications-development", "Development"); }
-    static Subcategory Education()   { return Subcategory("Education",   "applications-science",     "Education"  ); }
-    static Subcategory Games()       { return Subcategory("Games",       "applications-games",       "Game"       ); }
-    static Subcategory Graphics()    { return Subcategory("Graphics",    "applications-graphics",    "Graphics"   ); }
-    static Subcategory Internet()    { return Subcategory("Internet",    "applications-internet",    "Network"    ); }
-    static Subcategory Multimedia()  { return Subcategory("Multimedia",  "applications-multimedia",  "AudioVideo" ); }
-    static Subcategory Office()      { return Subcategory("Office",      "applications-office",      "Office"     ); }
-    static Subcategory Science()     { return Subcategory("Science",     "applications-science",     "Science"    ); }
-    static Subcategory System()      { return Subcategory("System",      "applications-system",      "System"     ); }
+    static Subcategory Others() { return Subcategory("Others", "applications-others", "Others"); }
+    static size_t DefaultCount();
+    static Subcategory Default(size_t position);
 
 private:
     std::string display_name_;
     std::string icon_name_;
     std::vector<std::string> classification_names_;
-    std::vector<xdg::DesktopEntry> desktop_entries_;
+    CategorySet classifications_;
+    std::vector<size_t> desktop_entry_positions_;
 };
 } // namespace amm
 
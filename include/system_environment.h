@@ -35,6 +35,11 @@ public:
     std::string language() const { return language_; }
     std::vector<std::string> applicationDirectories() const;
     std::vector<std::string> iconThemeDirectories() const;
+    std::string homeApplicationDirectory() const;
+    std::string homeIconThemeDirectory() const;
+    std::vector<std::string> systemApplicationDirectories() const;
+    std::vector<std::string> systemIconThemeDirectories() const;
+    SystemEnvironment forHome(const std::string &home) const;
 
 private:
     std::string home_;
@@ -26,6 +26,7 @@ namespace amm {
 namespace timex {
 std::string currentTimeAsTimestamp();
 std::string currentTimeAsReadble();
+double monotonicMilliseconds();
 } // namespace timex
 } // namespace amm
 
@@ -0,0 +1,97 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_TIMINGS_H_
+#define AMM_TIMINGS_H_
+
+#include <string>
+#include <vector>
+
+#include "trace.h"
+
+namespace amm {
+// Understands how long each phase of a run took, and how much it allocated when allocations are counted
+// A phase started inside another pauses the outer one, so no time is counted twice
+class Timings
+{
+public:
+    Timings() : mark_(0), allocations_mark_(0), allocated_bytes_mark_(0), trace_(NULL) { }
+    void registerTrace(Trace &trace) { trace_ = &trace; }
+    void start(const std::string &phase);
+    void start(const std::string &phase, const std::string &detail);
+    void stop();
+    std::vector<std::string> phases() const { return phases_; }
+    double milliseconds(const std::string &phase) const;
+    size_t allocations(const std::string &phase) const;
+    size_t allocatedBytes(const std::string &phase) const;
+    double totalMilliseconds() const;
+    size_t totalAllocations() const;
+    size_t totalAllocatedBytes() const;
+    std::string table() const;
+    std::string json() const;
+
+private:
+    std::vector<std::string> phases_;
+    std::vector<double> milliseconds_;
+    std::vector<size_t> allocations_;
+    std::vector<size_t> allocated_bytes_;
+    std::vector<size_t> running_;
+    std::vector<double> started_at_;
+    std::vector<std::string> details_;
+    double mark_;
+    size_t allocations_mark_;
+    size_t allocated_bytes_mark_;
+    Trace *trace_;
+
+    size_t positionOf(const std::string &phase);
+    size_t findPosition(const std::string &phase) const;
+    void accumulateUntil(double now);
+};
+
+// Understands timing a phase for as long as it is in scope
+class TimedPhase
+{
+public:
+    TimedPhase(Timings *timings, const std::string &phase) : timings_(timings)
+    {
+        if (timings_ != NULL) {
+            timings_->start(phase);
+        }
+    }
+    TimedPhase(Timings *timings, const std::string &phase, const std::string &detail) : timings_(timings)
+    {
+        if (timings_ != NULL) {
+            timings_->start(phase, detail);
+        }
+    }
+    ~TimedPhase()
+    {
+        if (timings_ != NULL) {
+            timings_->stop();
+        }
+    }
+
+private:
+    Timings *timings_;
+
+    TimedPhase(const TimedPhase &);
+    TimedPhase &operator=(const TimedPhase &);
+};
+} // namespace amm
+
+#endif // AMM_TIMINGS_H_
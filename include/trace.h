@@ -0,0 +1,50 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_TRACE_H_
+#define AMM_TRACE_H_
+
+#include <string>
+#include <vector>
+
+namespace amm {
+// Understands spans of a run in the Chrome trace-event format
+class Trace
+{
+public:
+    Trace();
+    void addSpan(const std::string &name, const std::string &detail, double start_milliseconds, double end_milliseconds);
+    size_t size() const { return spans_.size(); }
+    std::string json() const;
+
+private:
+    struct Span
+    {
+        std::string name;
+        std::string detail;
+        double start_milliseconds;
+        double end_milliseconds;
+    };
+
+    int process_id_;
+    double origin_milliseconds_;
+    std::vector<Span> spans_;
+};
+} // namespace amm
+
+#endif // AMM_TRACE_H_
@@ -31,6 +31,8 @@
 namespace amm {
 namespace transformer {
 // Understands the conversion of representations into a JWM menu
+// The append methods write the same text as transform, without a trailing newline, at the end of a reusable buffer
+// The static ones lay out each line from its plain fields, for callers that hold no representation
 class Jwm : public TransformerInterface
 {
 public:
@@ -39,6 +41,22 @@ public:
     virtual std::string transform(const representation::SubcategoryStart &entry) const;
     virtual std::string transform(const representation::SubcategoryEnd &entry) const;
     virtual std::string transform(const representation::Program &entry) const;
+
+    void append(const representation::MenuStart &entry, std::string *buffer) const;
+    void append(const representation::MenuEnd &entry, std::string *buffer) const;
+    void append(const representation::SubcategoryStart &entry, std::string *buffer) const;
+    void append(const representation::SubcategoryEnd &entry, std::string *buffer) const;
+    void append(const representation::Program &entry, std::string *buffer) const;
+
+    static void appendMenuStart(const std::string &name, std::string *buffer);
+    static void appendMenuEnd(const std::string &name, std::string *buffer);
+    static void appendSubcategoryStart(const std::string &name, const std::string &icon, std::string *buffer);
+    static void appendSubcategoryEnd(const std::string &name, std::string *buffer);
+    static void appendProgram(const std::string &name, const std::string &icon, const std::string &executable, std::string *buffer);
+
+private:
+    static const char kMenuIndent[];
+    static const char kEntryIndent[];
 };
 } // namespace transformer
 } // namespace amm
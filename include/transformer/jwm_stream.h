@@ -0,0 +1,46 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_TRANSFORMER_JWM_STREAM_H_
+#define AMM_TRANSFORMER_JWM_STREAM_H_
+
+#include <string>
+
+#include "transformer/stream_transformer_interface.h"
+
+namespace amm {
+namespace transformer {
+// Understands appending a JWM menu, line by line, to a single output buffer
+class JwmStream : public StreamTransformerInterface
+{
+public:
+    explicit JwmStream(std::string *output) : output_(output) {}
+
+    virtual void menuStart(const std::string &name);
+    virtual void menuEnd(const std::string &name);
+    virtual void subcategoryStart(const std::string &name, const std::string &icon);
+    virtual void subcategoryEnd(const std::string &name);
+    virtual void program(const std::string &name, const std::string &icon, const std::string &executable, const std::string &comment);
+
+private:
+    std::string *output_;
+};
+} // namespace transformer
+} // namespace amm
+
+#endif // AMM_TRANSFORMER_JWM_STREAM_H_
@@ -0,0 +1,40 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_TRANSFORMER_STREAM_TRANSFORMER_INTERFACE_H_
+#define AMM_TRANSFORMER_STREAM_TRANSFORMER_INTERFACE_H_
+
+#include <string>
+
+namespace amm {
+namespace transformer {
+// Understands receiving a menu as a sequence of events, in the order it is walked
+class StreamTransformerInterface
+{
+public:
+    virtual ~StreamTransformerInterface() {}
+    virtual void menuStart(const std::string &name) = 0;
+    virtual void menuEnd(const std::string &name) = 0;
+    virtual void subcategoryStart(const std::string &name, const std::string &icon) = 0;
+    virtual void subcategoryEnd(const std::string &name) = 0;
+    virtual void program(const std::string &name, const std::string &icon, const std::string &executable, const std::string &comment) = 0;
+};
+} // namespace transformer
+} // namespace amm
+
+#endif // AMM_TRANSFORMER_STREAM_TRANSFORMER_INTERFACE_H_
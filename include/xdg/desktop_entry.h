@@ -22,9 +22,13 @@
 #include <string>
 #include <vector>
 
+#include "xdg/locale.h"
+
 namespace amm {
 namespace xdg {
 
+class Entry;
+
 // Understands the representation of a FreeDesktop .desktop file
 class DesktopEntry
 {
@@ -34,19 +38,20 @@ public:
     std::string name() const { return name_; }
     std::string icon() const { return icon_; }
     std::string executable() const { return executable_; }
-    std::vector<std::string> categories() const { return categories_; }
+    const std::vector<std::string> &categories() const { return categories_; }
     std::string comment() const { return comment_; }
     bool display() const { return display_; }
 
-    void hasLanguage(const std::string &language) { language_ = language; }
-
     bool operator < (const DesktopEntry &other) const;
     bool operator > (const DesktopEntry &other) const;
     bool operator == (const DesktopEntry &other) const;
     bool operator != (const DesktopEntry &other) const;
 
     void parse(const std::vector<std::string> &lines);
+    void parse(const std::vector<std::string> &lines, const Locale &locale);
+    static std::vector<DesktopEntry> ParsedForEach(const std::vector<std::string> &lines, const std::vector<Locale> &locales);
     bool isValid() const;
+    std::string collationKey() const;
     bool isA(const std::string &type) const;
     bool isAnyOf(const std::vector<std::string> &types) const;
 
@@ -57,7 +62,8 @@ private:
     std::vector<std::string> categories_;
     std::string comment_;
     bool display_;
-    std::string language_;
+
+    void populate(Entry &xdg_entry, size_t locale_position);
 };
 
 } // namespace xdg
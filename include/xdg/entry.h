@@ -23,6 +23,8 @@
 #include <vector>
 #include <map>
 
+#include "xdg/locale.h"
+
 namespace amm {
 namespace xdg {
 
@@ -30,15 +32,19 @@ namespace xdg {
 class Entry
 {
 public:
-    Entry(const std::vector<std::string> &lines, const std::string &language) : lines_(lines), language_(language) { }
-    explicit Entry(const std::vector<std::string> &lines) : lines_(lines) { }
+    Entry(const std::vector<std::string> &lines, const Locale &locale);
+    Entry(const std::vector<std::string> &lines, const std::vector<Locale> &locales);
+    explicit Entry(const std::vector<std::string> &lines);
     void parse();
     std::string under(const std::string &section_name, const std::string &key_name); //TODO : make const under C++11
+    std::string under(const std::string &section_name, const std::string &key_name, size_t locale_position);
 
 private:
+    typedef std::map< std::string, std::map< std::string, std::string > > Sections;
+
     std::vector<std::string> lines_;
-    std::string language_;
-    std::map< std::string, std::map< std::string, std::string > > result_;
+    std::vector<Locale> locales_;
+    std::vector<Sections> results_;
 };
 
 } // namespace xdg
@@ -0,0 +1,38 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_XDG_EXEC_H_
+#define AMM_XDG_EXEC_H_
+
+#include <string>
+
+namespace amm {
+namespace xdg {
+
+// Understands the command line in the Exec key of a FreeDesktop .desktop file
+// The command line is read in place and cleaned straight into the buffer, without copying it
+class Exec
+{
+public:
+    static void appendWithoutFieldCodes(const std::string &command_line, std::string *buffer);
+};
+
+} // namespace xdg
+} // namespace amm
+
+#endif // AMM_XDG_EXEC_H_
@@ -0,0 +1,48 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AMM_XDG_LOCALE_H_
+#define AMM_XDG_LOCALE_H_
+
+#include <string>
+#include <vector>
+
+namespace amm {
+namespace xdg {
+
+// Understands the order in which localized keys are preferred as per FreeDesktop guidelines
+class Locale
+{
+public:
+    Locale() {}
+    explicit Locale(const std::string &name);
+
+    std::vector<std::string> candidates() const { return candidates_; }
+    size_t unlocalizedRank() const { return candidates_.size(); }
+    size_t rank(const std::string &text, size_t position, size_t length) const;
+
+    static const size_t kNoMatch;
+
+private:
+    std::vector<std::string> candidates_;
+};
+
+} // namespace xdg
+} // namespace amm
+
+#endif // AMM_XDG_LOCALE_H_
@@ -0,0 +1,59 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "allocation_counters.h"
+
+#include <sys/resource.h>
+#include <string>
+
+namespace amm {
+
+// Zero-initialised before any constructor runs, so allocations made during static initialisation are counted too
+static AllocationCounters process_counters = {0, 0, 0, 0, 0};
+
+AllocationCounters &AllocationCounters::Process()
+{
+    return process_counters;
+}
+
+void AllocationCounters::recordAllocation(size_t size)
+{
+    ++allocations;
+    allocated_bytes += size;
+    live_bytes += size;
+    if (live_bytes > peak_live_bytes) {
+        peak_live_bytes = live_bytes;
+    }
+}
+
+void AllocationCounters::recordDeallocation(size_t size)
+{
+    ++deallocations;
+    live_bytes -= size;
+}
+
+size_t AllocationCounters::PeakResidentKilobytes()
+{
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return static_cast<size_t>(usage.ru_maxrss);
+}
+
+} // namespace amm
@@ -0,0 +1,107 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Replaces the global operator new and delete to count every heap allocation
+// Linked into mjwm_test and mjwm_accounting only; mjwm itself keeps the allocator of the C++ library
+
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counters.h"
+
+// The size is kept in front of each block; 16 bytes keep the alignment malloc gives
+static const size_t kHeaderSize = 16;
+
+static void *allocate(std::size_t size)
+{
+    void *block = std::malloc(size + kHeaderSize);
+    if (block == NULL) {
+        return NULL;
+    }
+    *static_cast<std::size_t*>(block) = size;
+    amm::AllocationCounters::Process().recordAllocation(size);
+    return static_cast<char*>(block) + kHeaderSize;
+}
+
+static void release(void *pointer)
+{
+    if (pointer == NULL) {
+        return;
+    }
+    void *block = static_cast<char*>(pointer) - kHeaderSize;
+    amm::AllocationCounters::Process().recordDeallocation(*static_cast<std::size_t*>(block));
+    std::free(block);
+}
+
+void *operator new(std::size_t size)
+{
+    void *pointer = allocate(size);
+    if (pointer == NULL) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void *operator new[](std::size_t size)
+{
+    void *pointer = allocate(size);
+    if (pointer == NULL) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &)
+{
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &)
+{
+    return allocate(size);
+}
+
+void operator delete(void *pointer)
+{
+    release(pointer);
+}
+
+void operator delete[](void *pointer)
+{
+    release(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &)
+{
+    release(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &)
+{
+    release(pointer);
+}
+
+void operator delete(void *pointer, std::size_t)
+{
+    release(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t)
+{
+    release(pointer);
+}
@@ -18,14 +18,20 @@
 
 #include "amm.h"
 
+#include <unistd.h>
 #include <cstdlib>
 #include <iostream>
+#include <map>
+#include <set>
 #include <fstream>
 #include <string>
 #include <vector>
 
 #include "vectorx.h"
 #include "filex.h"
+#include "directoryx.h"
+#include "fingerprint.h"
+#include "backup_files.h"
 #include "timex.h"
 #include "messages.h"
 #include "amm_options.h"
@@ -34,14 +40,29 @@
 #include "icon_search/icon_search_interface.h"
 #include "icon_search/xdg_search.h"
 #include "icon_search/caching_search.h"
+#include "icon_search/timed_search.h"
+#include "icon_search/layered_search.h"
 #include "qualified_icon_theme.h"
 #include "desktop_entry_file_search.h"
 #include "stats.h"
 #include "menu.h"
-#include "transformer/jwm.h"
+#include "subcategory.h"
+#include "timings.h"
+#include "trace.h"
+#include "report.h"
+#include "io_counters.h"
+#include "local_socket.h"
+#include "local_socket_standby.h"
+#include "home_owner.h"
+#include "desktop_entry_cache.h"
+#include "xdg/locale.h"
+#include "transformer/jwm_stream.h"
 
 namespace amm {
 
+// How often an idle daemon looks for changed inputs
+static const int kDaemonRefreshMilliseconds = 2000;
+
 static inline void displayToSTDOUT(std::string message)
 {
     std::cout << message << std::endl;
@@ -55,18 +76,27 @@ static inline void displayToSTDERR(std::string message)
 Amm::Amm()
 {
     actual_searcher_ = NULL;
+    caching_searcher_ = NULL;
 }
 
 Amm::~Amm()
 {
+    for (std::vector<Menu*>::iterator menu = translated_menus_.begin(); menu != translated_menus_.end(); ++menu) {
+        delete *menu;
+    }
+    if (caching_searcher_ != NULL) {
+        delete caching_searcher_;
+        caching_searcher_ = NULL;
+    }
     if (actual_searcher_ != NULL) {
         delete actual_searcher_;
         actual_searcher_ = NULL;
     }
 }
 
-void Amm::validateEnvironment() const
+void Amm::validateEnvironment()
 {
+    TimedPhase phase(&timings_, "environment");
     if (!environment_.isValid()) {
         displayToSTDERR(messages::homeNotSet());
         exit(2);
@@ -75,6 +105,7 @@ void Amm::validateEnvironment() const
 
 void Amm::loadCommandLineOption(int argc, char **argv)
 {
+    TimedPhase phase(&timings_, "option parsing");
     options_ = CommandLineOptionsParser(environment_.home(), environment_.language()).parse(argc, argv);
     std::vector<std::string> deprecations = options_.deprecations;
     if (!deprecations.empty()) {
@@ -88,6 +119,34 @@ void Amm::loadCommandLineOption(int argc, char **argv)
         displayToSTDERR(messages::badSummaryType(options_.summary_type));
         exit(2);
     }
+    if (!options_.hasValidTimingsFormat()) {
+        displayToSTDERR(messages::badTimingsFormat(options_.timings_format));
+        exit(2);
+    }
+    if (!options_.hasValidReportFormat()) {
+        displayToSTDERR(messages::badReportFormat(options_.report_format));
+        exit(2);
+    }
+    if (options_.is_daemon && options_.is_client) {
+        displayToSTDERR(messages::daemonWithClient());
+        exit(2);
+    }
+    if (options_.is_daemon && (options_.trace_file_name != "" || options_.timings_format != "" || options_.report_format != "")) {
+        displayToSTDERR(messages::daemonWithRunReports());
+        exit(2);
+    }
+    if (options_.batch_file_name != "" && (options_.is_if_changed || options_.report_format != "" || options_.is_daemon || options_.is_client || options_.is_dynamic)) {
+        displayToSTDERR(messages::batchWithSingleRunOptions());
+        exit(2);
+    }
+    size_t language_count = options_.languages().size();
+    if (language_count > 1 && (options_.report_format != "" || options_.is_daemon || options_.is_client || options_.is_dynamic)) {
+        displayToSTDERR(messages::languagesWithSingleMenuOptions());
+        exit(2);
+    }
+    if (options_.trace_file_name != "") {
+        timings_.registerTrace(trace_);
+    }
     if (options_.is_help) {
         displayToSTDOUT(messages::help());
         exit(0);
@@ -96,16 +155,252 @@ void Amm::loadCommandLineOption(int argc, char **argv)
         displayToSTDOUT(messages::version());
         exit(0);
     }
+    for (size_t position = 1; position < language_count; ++position) {
+        translated_menus_.push_back(new Menu());
+    }
+}
+
+// The menu of the first language comes first, followed by those of the other languages
+std::vector<Menu*> Amm::menus()
+{
+    std::vector<Menu*> all_menus(1, &menu_);
+    all_menus.insert(all_menus.end(), translated_menus_.begin(), translated_menus_.end());
+    return all_menus;
+}
+
+// A client writes the menu a daemon serves, as a run of its own would, and exits
+// A dynamic menu is printed instead, and built by this run when no daemon answers in time
+void Amm::runClient()
+{
+    if (!options_.is_client) {
+        return;
+    }
+    std::string output;
+    if (!LocalSocket(options_.socket_name).request(options_.dynamic_subcategory_name, &output) || output == "") {
+        if (options_.is_dynamic) {
+            return;
+        }
+        displayToSTDERR(messages::noDaemon(options_.socket_name));
+        exit(1);
+    }
+    if (options_.is_dynamic) {
+        std::cout << output;
+        exit(0);
+    }
+    if (!writeOutput(options_.output_file_name, output)) {
+        exit(1);
+    }
+    removeOldBackups();
+    printOutputFile();
+    exit(0);
+}
+
+// A daemon reads the inputs again only when their fingerprint changed since the menu it serves was built
+void Amm::runDaemon()
+{
+    if (!options_.is_daemon) {
+        return;
+    }
+    LocalSocket socket(options_.socket_name);
+    if (!socket.listen()) {
+        displayToSTDERR(messages::badSocket(options_.socket_name));
+        exit(1);
+    }
+
+    std::string served_fingerprint;
+    rebuildMenu(&served_fingerprint);
+    displayToSTDOUT(messages::servingMenus(options_.socket_name));
+    for (;;) {
+        if (socket.waitForConnection(kDaemonRefreshMilliseconds) && !socket.answerConnection(*this)) {
+            displayToSTDERR(messages::badSocket(options_.socket_name));
+            exit(1);
+        }
+
+        // While the menu is rebuilt, a forked copy of the daemon answers from the menu it replaces,
+        // so clients are not left waiting however long the rebuild takes
+        if (inputFingerprint() != served_fingerprint) {
+            LocalSocketStandby standby(socket, *this);
+            rebuildMenu(&served_fingerprint);
+            daemon_outputs_.clear();
+        }
+    }
+}
+
+// Each request names a subcategory, or nothing for the whole menu; every answer is kept until the menu is rebuilt
+std::string Amm::answer(const std::string &subcategory_name)
+{
+    std::map<std::string, std::string>::iterator output = daemon_outputs_.find(subcategory_name);
+    if (output == daemon_outputs_.end()) {
+        output = daemon_outputs_.insert(std::make_pair(subcategory_name, menuOutput(menu_, subcategory_name))).first;
+    }
+    return output->second;
+}
+
+// Each listed home gets a menu of its own, while the system-wide desktop files and
+// icon themes are read once for all of them
+void Amm::runBatch()
+{
+    if (options_.batch_file_name == "") {
+        return;
+    }
+    std::vector<std::string> home_names = batchHomeNames();
+    readSharedDesktopEntryFiles();
+    {
+        TimedPhase phase(&timings_, "icon theme setup");
+        if (options_.is_iconize) {
+            createIconSearch(QualifiedIconTheme(environment_.systemIconThemeDirectories(), options_.icon_theme_name));
+        }
+    }
+
+    // A home that fails is reported and skipped, so that the others still get their menus
+    std::string output_name = options_.output_file_name.substr(options_.output_file_name.rfind('/') + 1);
+    size_t skipped_homes = 0;
+    for (std::vector<std::string>::const_iterator home = home_names.begin(); home != home_names.end(); ++home) {
+        if (!DirectoryX(*home).isValid()) {
+            displayToSTDERR(messages::badInputPaths(*home));
+            ++skipped_homes;
+            continue;
+        }
+        SystemEnvironment home_environment = environment_.forHome(*home);
+        std::vector<Menu*> all_menus = menus();
+        for (std::vector<Menu*>::iterator menu = all_menus.begin(); menu != all_menus.end(); ++menu) {
+            (*menu)->clear();
+        }
+        readCategories();
+
+        // The home is read and written as its owner, so that links planted there reach only what the owner may read
+        HomeOwner owner(*home);
+        if (!owner.isAssumed()) {
+            displayToSTDERR(messages::badHomeOwner(*home));
+            ++skipped_homes;
+            continue;
+        }
+        readHomeDesktopEntryFiles(home_environment);
+
+        // A user with icons of their own has them searched first, in the themes read for the system,
+        // falling back to the shared cache of the system icons
+        icon_search::XdgSearch *home_searcher = NULL;
+        icon_search::LayeredSearch *home_layered_searcher = NULL;
+        if (options_.is_iconize) {
+            TimedPhase phase(&timings_, "icon theme setup");
+            std::string home_icon_directory = home_environment.homeIconThemeDirectory();
+            if (DirectoryX(home_icon_directory).isValid()) {
+                home_searcher = new icon_search::XdgSearch(48, std::vector<std::string>(1, home_icon_directory), actual_searcher_->iconThemes());
+                home_layered_searcher = new icon_search::LayeredSearch(*home_searcher, *caching_searcher_);
+                registerIconSearch(*home_layered_searcher);
+            } else {
+                registerIconSearch(*caching_searcher_);
+            }
+        }
+
+        options_.output_file_name = StringX(*home).terminateWith("/") + output_name;
+        if (populateMenus() && writeOutputFiles()) {
+            removeOldBackups();
+            printOutputFile();
+        } else {
+            displayToSTDERR(messages::skippedHome(*home));
+            ++skipped_homes;
+        }
+
+        // The menus are moved back to the shared cache before the home's searchers they wrap are gone
+        if (home_layered_searcher != NULL) {
+            registerIconSearch(*caching_searcher_);
+        }
+        delete home_layered_searcher;
+        delete home_searcher;
+    }
+    printTimings();
+    writeTrace();
+    exit(skipped_homes > 0 ? 1 : 0);
+}
+
+// One home directory per line; empty lines and comments are skipped
+std::vector<std::string> Amm::batchHomeNames() const
+{
+    std::vector<std::string> lines;
+    if (!FileX(options_.batch_file_name).readLines(&lines)) {
+        displayToSTDERR(messages::badBatchFile(options_.batch_file_name));
+        exit(1);
+    }
+    std::vector<std::string> home_names;
+    for (std::vector<std::string>::const_iterator line = lines.begin(); line != lines.end(); ++line) {
+        std::string home_name = StringX(*line).trim();
+        if (home_name != "" && home_name[0] != '#') {
+            home_names.push_back(home_name);
+        }
+    }
+    return home_names;
+}
+
+// The system-wide desktop files are parsed once, in every language asked for
+void Amm::readSharedDesktopEntryFiles()
+{
+    timings_.start("discovery");
+    DesktopEntryFileSearch service;
+    if (options_.override_default_directories) {
+        service.registerDirectories(options_.input_directory_names);
+    } else {
+        service.registerSystemDirectories();
+    }
+    service.resolve();
+
+    std::vector<std::string> bad_paths = service.badPaths();
+    if (!bad_paths.empty()) {
+        displayToSTDERR(messages::badInputPaths(VectorX(bad_paths).join(", ")));
+    }
+    shared_desktop_entry_file_names_ = service.desktopEntryFileNames();
+    timings_.stop();
+
+    TimedPhase phase(&timings_, "parse");
+    std::vector<xdg::Locale> locales;
+    std::vector<std::string> languages = options_.languages();
+    for (std::vector<std::string>::const_iterator language = languages.begin(); language != languages.end(); ++language) {
+        locales.push_back(xdg::Locale(*language));
+    }
+    shared_entries_.load(shared_desktop_entry_file_names_, locales);
+}
+
+// The desktop files of a home come first, as they do for a single run
+void Amm::readHomeDesktopEntryFiles(const SystemEnvironment &home_environment)
+{
+    TimedPhase phase(&timings_, "discovery");
+    desktop_entry_file_names_.clear();
+    std::string home_directory = home_environment.homeApplicationDirectory();
+    if (DirectoryX(home_directory).isValid()) {
+        DesktopEntryFileSearch service;
+        service.registerDirectories(std::vector<std::string>(1, home_directory));
+        service.resolve();
+        desktop_entry_file_names_ = service.desktopEntryFileNames();
+    }
+    desktop_entry_file_names_.insert(desktop_entry_file_names_.end(), shared_desktop_entry_file_names_.begin(), shared_desktop_entry_file_names_.end());
+}
+
+// The fingerprint is taken after discovery, so that it covers the directories just visited
+void Amm::rebuildMenu(std::string *fingerprint)
+{
+    std::vector<Menu*> all_menus = menus();
+    for (std::vector<Menu*>::iterator menu = all_menus.begin(); menu != all_menus.end(); ++menu) {
+        (*menu)->clear();
+    }
+    readDesktopEntryFiles();
+    *fingerprint = inputFingerprint();
+    registerIconService();
+    readCategories();
+    populate();
 }
 
 void Amm::readCategories()
 {
+    TimedPhase phase(&timings_, "category load");
     std::string category_file_name = options_.category_file_name;
     std::vector<std::string> category_lines;
 
     if (category_file_name != "") {
         if (FileX(category_file_name).readLines(&category_lines)) {
-            menu_.loadCustomCategories(category_lines);
+            std::vector<Menu*> all_menus = menus();
+            for (std::vector<Menu*>::iterator menu = all_menus.begin(); menu != all_menus.end(); ++menu) {
+                (*menu)->loadCustomCategories(category_lines);
+            }
         } else {
             displayToSTDERR(messages::badCategoryFile(category_file_name));
             exit(1);
@@ -115,16 +410,33 @@ void Amm::readCategories()
 
 void Amm::registerIconService()
 {
+    TimedPhase phase(&timings_, "icon theme setup");
     if (options_.is_iconize) {
-        QualifiedIconTheme theme(environment_, options_.icon_theme_name);
-        actual_searcher_ = new icon_search::XdgSearch(48, theme);
-        icon_search::IconSearchInterface *icon_searcher = new icon_search::CachingSearch(*actual_searcher_);
-        menu_.registerIconService(*icon_searcher);
+        createIconSearch(QualifiedIconTheme(environment_, options_.icon_theme_name));
+        registerIconSearch(*caching_searcher_);
+    }
+}
+
+void Amm::createIconSearch(const QualifiedIconTheme &theme)
+{
+    delete caching_searcher_;
+    delete actual_searcher_;
+    actual_searcher_ = new icon_search::XdgSearch(48, theme);
+    caching_searcher_ = new icon_search::CachingSearch(*actual_searcher_);
+}
+
+// The menus share the searcher, so that each icon is resolved once whichever number of languages is built
+void Amm::registerIconSearch(icon_search::IconSearchInterface &icon_searcher)
+{
+    std::vector<Menu*> all_menus = menus();
+    for (std::vector<Menu*>::iterator menu = all_menus.begin(); menu != all_menus.end(); ++menu) {
+        (*menu)->registerIconService(*new icon_search::TimedSearch(icon_searcher, timings_));
     }
 }
 
 void Amm::readDesktopEntryFiles()
 {
+    TimedPhase phase(&timings_, "discovery");
     std::vector<std::string> input_directory_names = options_.input_directory_names;
 
     DesktopEntryFileSearch service;
@@ -140,57 +452,302 @@ void Amm::readDesktopEntryFiles()
         displayToSTDERR(messages::badInputPaths(VectorX(bad_paths).join(", ")));
     }
     desktop_entry_file_names_ = service.desktopEntryFileNames();
+    visited_directory_names_ = service.visitedDirectoryNames();
+}
+
+std::string Amm::inputFingerprint() const
+{
+    Fingerprint fingerprint;
+    fingerprint.addText(messages::version());
+    fingerprint.addText(options_.language);
+    fingerprint.addCollation();
+    fingerprint.addText(options_.category_file_name);
+    if (options_.category_file_name != "") {
+        fingerprint.addModificationTime(options_.category_file_name);
+    }
+
+    for (std::vector<std::string>::const_iterator name = visited_directory_names_.begin(); name != visited_directory_names_.end(); ++name) {
+        fingerprint.addModificationTime(*name);
+    }
+
+    if (options_.is_iconize) {
+        fingerprint.addText(options_.icon_theme_name);
+        fingerprint.addIconThemes(environment_.iconThemeDirectories());
+    }
+    return fingerprint.hex();
+}
+
+// Leading comment lines form the header; the menu follows them
+static size_t menuStart(const std::string &output)
+{
+    size_t start = 0;
+    while (output.compare(start, 4, "<!--") == 0) {
+        size_t end = output.find('\n', start);
+        if (end == std::string::npos) {
+            return output.size();
+        }
+        start = end + 1;
+    }
+    return start;
+}
+
+void Amm::exitIfUnchanged()
+{
+    if (!options_.is_if_changed || options_.is_dynamic) {
+        return;
+    }
+    timings_.start("fingerprint");
+    fingerprint_ = inputFingerprint();
+
+    // Every output file has to carry the fingerprint for the run to be skipped
+    std::vector<std::string> output_file_names = options_.outputFileNames();
+    for (std::vector<std::string>::const_iterator name = output_file_names.begin(); name != output_file_names.end(); ++name) {
+        std::string existing_output;
+        if (!FileX(*name).read(&existing_output)) {
+            timings_.stop();
+            return;
+        }
+        std::string header = existing_output.substr(0, menuStart(existing_output));
+        if (header.find(messages::fingerprintOf(fingerprint_)) == std::string::npos) {
+            timings_.stop();
+            return;
+        }
+    }
+    timings_.stop();
+    if (options_.report_format == "json") {
+        printReport("skipped");
+    } else {
+        for (std::vector<std::string>::const_iterator name = output_file_names.begin(); name != output_file_names.end(); ++name) {
+            displayToSTDOUT(messages::unchangedInputs(*name));
+        }
+        printTimings();
+    }
+    writeTrace();
+    exit(0);
 }
 
 void Amm::populate()
 {
-    menu_.registerLanguage(options_.language);
-    menu_.populate(desktop_entry_file_names_);
+    if (!populateMenus()) {
+        exit(1);
+    }
+}
+
+bool Amm::populateMenus()
+{
+    timings_.start("parse");
+    std::vector<std::string> languages = options_.languages();
+    std::vector<Menu*> all_menus = menus();
+    for (size_t position = 0; position < all_menus.size(); ++position) {
+        all_menus[position]->registerLanguage(languages[position]);
+        all_menus[position]->registerTimings(timings_);
+    }
+    if (options_.summary_type == "long" || options_.report_format == "json") {
+        menu_.retainSummaryDetails();
+    }
+    Menu::PopulateAll(all_menus, desktop_entry_file_names_, shared_entries_);
+    timings_.stop();
     if (menu_.summary().totalParsedFiles() == 0) {
         displayToSTDERR(messages::noValidDesktopEntryFiles());
-        exit(1);
+        return false;
+    }
+
+    TimedPhase phase(&timings_, "sort");
+    for (std::vector<Menu*>::iterator menu = all_menus.begin(); menu != all_menus.end(); ++menu) {
+        (*menu)->sort();
     }
-    menu_.sort();
+    return true;
 }
 
-void Amm::writeOutputFile()
+static bool hasSameMenu(const std::string &existing, const std::string &generated)
+{
+    size_t existing_start = menuStart(existing);
+    size_t generated_start = menuStart(generated);
+    return existing.compare(existing_start, std::string::npos, generated, generated_start, std::string::npos) == 0;
+}
+
+// The first line only carries the generation time, so it is left out of the comparison
+static bool hasSameOutput(const std::string &existing, const std::string &generated)
 {
-    transformer::Jwm jwm_transformer;
-    std::vector<representation::RepresentationInterface*> representations = menu_.representations();
-    std::vector<std::string> output;
+    size_t existing_start = existing.find('\n');
+    size_t generated_start = generated.find('\n');
+    if (existing_start == std::string::npos || generated_start == std::string::npos) {
+        return false;
+    }
+    return existing.compare(existing_start, std::string::npos, generated, generated_start, std::string::npos) == 0;
+}
 
-    output.push_back(messages::autogeneratedByAmm());
+// A subcategory is a menu of its own, without the header of the output file
+std::string Amm::menuOutput(const Menu &menu, const std::string &subcategory_name) const
+{
+    std::string output;
+    if (subcategory_name != "") {
+        transformer::JwmStream jwm_transformer(&output);
+        menu.stream(jwm_transformer, subcategory_name);
+        return output;
+    }
 
-    for (std::vector<representation::RepresentationInterface*>::const_iterator representation = representations.begin(); representation != representations.end(); ++representation) {
-        output.push_back((*representation)->visit(jwm_transformer));
-        delete *representation;
+    output = messages::autogeneratedByAmm() + "\n";
+    if (fingerprint_ != "") {
+        output += messages::fingerprintOf(fingerprint_) + "\n";
     }
+    transformer::JwmStream jwm_transformer(&output);
+    menu.stream(jwm_transformer);
+    return output;
+}
+
+// A dynamic menu goes to stdout for JWM, instead of to the output file
+void Amm::printDynamicMenu()
+{
+    if (!options_.is_dynamic) {
+        return;
+    }
+    timings_.start("transform");
+    std::cout << menuOutput(menu_, options_.dynamic_subcategory_name);
+    timings_.stop();
+    writeTrace();
+    exit(0);
+}
+
+void Amm::writeOutputFile()
+{
+    if (!writeOutputFiles()) {
+        exit(1);
+    }
+}
+
+bool Amm::writeOutputFiles()
+{
+    std::vector<std::string> output_file_names = options_.outputFileNames();
+    std::vector<Menu*> all_menus = menus();
+    for (size_t position = 0; position < all_menus.size(); ++position) {
+        timings_.start("transform");
+        std::string output = menuOutput(*all_menus[position], "");
+        timings_.stop();
+        if (!writeOutput(output_file_names[position], output)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Amm::writeOutput(const std::string &output_file_name, const std::string &output)
+{
+    TimedPhase phase(&timings_, "write");
 
-    std::string output_file_name = options_.output_file_name;
     FileX output_file = FileX(output_file_name);
     if (output_file.existsAsDirectory()) {
         displayToSTDERR(messages::outputPathBlockedByDirectory(output_file_name));
-        exit(1);
+        return false;
     }
-    if (output_file.exists()) {
-        if (options_.is_backup) {
+
+    std::string existing_output;
+    if (output_file.read(&existing_output)) {
+        if (hasSameOutput(existing_output, output)) {
+            unchanged_file_names_.insert(output_file_name);
+            return true;
+        }
+        // A menu that differs only in its header is refreshed without a backup
+        if (options_.is_backup && !hasSameMenu(existing_output, output)) {
             std::string backup_file_name = output_file_name + "." + timex::currentTimeAsTimestamp() + ".bak";
-            output_file.moveTo(backup_file_name);
-            displayToSTDOUT(messages::backupFile(output_file_name, backup_file_name));
-        } else {
-            output_file.purge();
+            if (!FileX(backup_file_name).replaceWith(existing_output)) {
+                displayToSTDERR(messages::badBackupFile(backup_file_name));
+                return false;
+            }
+            backup_file_names_[output_file_name] = backup_file_name;
+            if (options_.report_format == "") {
+                displayToSTDOUT(messages::backupFile(output_file_name, backup_file_name));
+            }
         }
     }
-    if (!output_file.writeLines(output)) {
-        displayToSTDERR(messages::badOutputFile(options_.output_file_name));
-        exit(1);
+
+    if (!output_file.replaceWith(output)) {
+        displayToSTDERR(messages::badOutputFile(output_file_name));
+        return false;
+    }
+    return true;
+}
+
+void Amm::removeOldBackups()
+{
+    TimedPhase phase(&timings_, "write");
+    if (!options_.is_backup_limited) {
+        return;
+    }
+    std::vector<std::string> output_file_names = options_.outputFileNames();
+    for (std::vector<std::string>::const_iterator name = output_file_names.begin(); name != output_file_names.end(); ++name) {
+        removed_backups_[*name] = BackupFiles(*name).removeAllBut(options_.backups_to_keep);
     }
 }
 
 void Amm::printSummary() const
 {
+    if (options_.report_format == "json") {
+        printReport(unchanged_file_names_.count(options_.outputFileNames().front()) > 0 ? "unchanged" : "created");
+        return;
+    }
     displayToSTDOUT(menu_.summary().details(options_.summary_type)); // extra line
-    displayToSTDOUT("Created " + options_.output_file_name);
+    if (options_.summary_type == "long") {
+        displayToSTDOUT(IoCounters::Process().details());
+    }
+    printOutputFile();
+    printTimings();
+}
+
+void Amm::printOutputFile() const
+{
+    std::vector<std::string> output_file_names = options_.outputFileNames();
+    for (std::vector<std::string>::const_iterator name = output_file_names.begin(); name != output_file_names.end(); ++name) {
+        std::map<std::string, size_t>::const_iterator removed = removed_backups_.find(*name);
+        if (removed != removed_backups_.end() && removed->second > 0) {
+            displayToSTDOUT(messages::removedBackupFiles(*name, removed->second));
+        }
+        if (unchanged_file_names_.count(*name) > 0) {
+            displayToSTDOUT(messages::unchangedOutputFile(*name));
+        } else {
+            displayToSTDOUT(messages::createdOutputFile(*name));
+        }
+    }
+}
+
+void Amm::writeTrace() const
+{
+    if (options_.trace_file_name == "") {
+        return;
+    }
+    if (!FileX(options_.trace_file_name).replaceWith(trace_.json())) {
+        displayToSTDERR(messages::badTraceFile(options_.trace_file_name));
+        exit(1);
+    }
+}
+
+void Amm::printTimings() const
+{
+    if (options_.timings_format == "table") {
+        displayToSTDOUT(timings_.table());
+    } else if (options_.timings_format == "json") {
+        displayToSTDOUT(timings_.json());
+    }
+}
+
+void Amm::printReport(const std::string &status) const
+{
+    // The report describes the menu of the first language
+    std::string output_file_name = options_.outputFileNames().front();
+    std::map<std::string, std::string>::const_iterator backup = backup_file_names_.find(output_file_name);
+    std::map<std::string, size_t>::const_iterator removed = removed_backups_.find(output_file_name);
+    Report report(messages::version(), menu_.summary(), timings_);
+    report.registerOutput(output_file_name, status,
+                          backup == backup_file_names_.end() ? "" : backup->second,
+                          removed == removed_backups_.end() ? 0 : removed->second);
+    if (caching_searcher_ != NULL) {
+        report.registerIconLookups(caching_searcher_->lookups(), caching_searcher_->cacheHits(), caching_searcher_->resolvedLookups());
+    }
+    const std::vector<Subcategory> &subcategories = menu_.subcategories();
+    for (std::vector<Subcategory>::const_iterator subcategory = subcategories.begin(); subcategory != subcategories.end(); ++subcategory) {
+        report.addCategory(subcategory->displayName(), subcategory->desktopEntryPositions().size());
+    }
+    displayToSTDOUT(report.json());
 }
 
 } // namespace amm
@@ -19,6 +19,8 @@
 #include "amm_options.h"
 
 #include <string>
+#include <vector>
+
 #include "stringx.h"
 
 namespace amm {
@@ -30,11 +32,46 @@ AmmOptions AmmOptions::Default(const std::string &home, const std::string &langu
     amm_options.is_version = false;
     amm_options.is_iconize = false;
     amm_options.is_backup = true;
+    amm_options.is_backup_limited = false;
+    amm_options.backups_to_keep = 0;
+    amm_options.is_if_changed = false;
     amm_options.override_default_directories = false;
     amm_options.summary_type = "normal";
     amm_options.output_file_name = StringX(home).terminateWith("/") + (".jwmrc-mjwm");
     amm_options.icon_theme_name = "hicolor";
     amm_options.language = language;
+    amm_options.timings_format = "";
+    amm_options.trace_file_name = "";
+    amm_options.report_format = "";
+    amm_options.is_daemon = false;
+    amm_options.is_client = false;
+    amm_options.socket_name = StringX(home).terminateWith("/") + (".mjwm-socket");
+    amm_options.is_dynamic = false;
+    amm_options.dynamic_subcategory_name = "";
+    amm_options.batch_file_name = "";
     return amm_options;
 }
+
+// Several languages may be asked for at once, separated by colons
+std::vector<std::string> AmmOptions::languages() const
+{
+    std::vector<std::string> names = StringX(language).split(":");
+    if (names.empty()) {
+        names.push_back(language);
+    }
+    return names;
+}
+
+// With several languages, each menu is written next to the output file, suffixed with its language
+std::vector<std::string> AmmOptions::outputFileNames() const
+{
+    std::vector<std::string> names = languages();
+    if (names.size() == 1) {
+        return std::vector<std::string>(1, output_file_name);
+    }
+    for (std::vector<std::string>::iterator name = names.begin(); name != names.end(); ++name) {
+        *name = output_file_name + "." + *name;
+    }
+    return names;
+}
 } // namespace amm
@@ -0,0 +1,87 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "backup_files.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "stringx.h"
+#include "directoryx.h"
+
+namespace amm {
+
+static const size_t kTimestampLength = 14;
+static const std::string kBackupSuffix = ".bak";
+
+BackupFiles::BackupFiles(const std::string &file_name)
+{
+    size_t separator = file_name.rfind('/');
+    if (separator == std::string::npos) {
+        directory_name_ = ".";
+        prefix_ = file_name + ".";
+    } else {
+        directory_name_ = separator == 0 ? "/" : file_name.substr(0, separator);
+        prefix_ = file_name.substr(separator + 1) + ".";
+    }
+}
+
+bool BackupFiles::isBackupName(const std::string &name) const
+{
+    if (name.size() != prefix_.size() + kTimestampLength + kBackupSuffix.size()
+            || name.compare(0, prefix_.size(), prefix_) != 0
+            || !StringX(name).endsWith(kBackupSuffix)) {
+        return false;
+    }
+    for (size_t position = prefix_.size(); position < prefix_.size() + kTimestampLength; ++position) {
+        if (name[position] < '0' || name[position] > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Found with a single scan of the directory, oldest first as the timestamps sort chronologically
+std::vector<std::string> BackupFiles::names() const
+{
+    std::vector<std::string> names;
+    DirectoryX::Entries entries = DirectoryX(directory_name_).allEntries();
+    for (DirectoryX::Entries::iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+        if (!entry->isDirectory() && isBackupName(entry->name())) {
+            names.push_back(StringX(directory_name_).terminateWith("/") + entry->name());
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+size_t BackupFiles::removeAllBut(size_t count) const
+{
+    std::vector<std::string> backups = names();
+    size_t removed = 0;
+    for (size_t position = 0; position + count < backups.size(); ++position) {
+        if (remove(backups[position].c_str()) == 0) {
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+} // namespace amm
@@ -0,0 +1,74 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "category_atoms.h"
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "category_set.h"
+
+namespace amm {
+
+size_t CategoryAtoms::intern(const std::string &name)
+{
+    std::map<std::string, size_t>::const_iterator existing = atoms_.find(name);
+    if (existing != atoms_.end()) {
+        return existing->second;
+    }
+
+    size_t atom = names_.size();
+    atoms_.insert(std::pair<std::string, size_t>(name, atom));
+    names_.push_back(name);
+    return atom;
+}
+
+bool CategoryAtoms::find(const std::string &name, size_t *atom) const
+{
+    std::map<std::string, size_t>::const_iterator existing = atoms_.find(name);
+    if (existing == atoms_.end()) {
+        return false;
+    }
+    *atom = existing->second;
+    return true;
+}
+
+CategorySet CategoryAtoms::internAll(const std::vector<std::string> &names)
+{
+    CategorySet result;
+    for (std::vector<std::string>::const_iterator name = names.begin(); name != names.end(); ++name) {
+        result.insert(intern(*name));
+    }
+    return result;
+}
+
+// Names that were never interned can't match any interned set, so they are left out
+CategorySet CategoryAtoms::knownOf(const std::vector<std::string> &names) const
+{
+    CategorySet result;
+    size_t atom;
+    for (std::vector<std::string>::const_iterator name = names.begin(); name != names.end(); ++name) {
+        if (find(*name, &atom)) {
+            result.insert(atom);
+        }
+    }
+    return result;
+}
+
+} // namespace amm
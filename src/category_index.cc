@@ -0,0 +1,59 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "category_index.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "category_atoms.h"
+
+namespace amm {
+
+void CategoryIndex::add(size_t atom, size_t subcategory_position)
+{
+    if (atom >= subcategories_by_atom_.size()) {
+        subcategories_by_atom_.resize(atom + 1);
+    }
+    std::vector<size_t> &positions = subcategories_by_atom_[atom];
+    if (std::find(positions.begin(), positions.end(), subcategory_position) == positions.end()) {
+        positions.push_back(subcategory_position);
+    }
+}
+
+// The positions are sorted and unique, even when several category names point to the same subcategory
+void CategoryIndex::subcategoriesFor(const std::vector<std::string> &category_names, const CategoryAtoms &category_atoms, std::vector<size_t> *subcategory_positions) const
+{
+    subcategory_positions->clear();
+
+    size_t atom;
+    for (std::vector<std::string>::const_iterator name = category_names.begin(); name != category_names.end(); ++name) {
+        if (category_atoms.find(*name, &atom) && atom < subcategories_by_atom_.size()) {
+            const std::vector<size_t> &positions = subcategories_by_atom_[atom];
+            subcategory_positions->insert(subcategory_positions->end(), positions.begin(), positions.end());
+        }
+    }
+
+    if (subcategory_positions->size() > 1) {
+        std::sort(subcategory_positions->begin(), subcategory_positions->end());
+        subcategory_positions->erase(std::unique(subcategory_positions->begin(), subcategory_positions->end()), subcategory_positions->end());
+    }
+}
+
+} // namespace amm
@@ -0,0 +1,62 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "category_set.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace amm {
+
+void CategorySet::insert(size_t atom)
+{
+    size_t word = atom / kBitsPerWord;
+    if (word >= words_.size()) {
+        words_.resize(word + 1, 0UL);
+    }
+    words_[word] |= 1UL << (atom % kBitsPerWord);
+}
+
+bool CategorySet::contains(size_t atom) const
+{
+    size_t word = atom / kBitsPerWord;
+    return word < words_.size() && (words_[word] & (1UL << (atom % kBitsPerWord))) != 0;
+}
+
+bool CategorySet::intersects(const CategorySet &other) const
+{
+    size_t common_words = std::min(words_.size(), other.words_.size());
+    for (size_t word = 0; word < common_words; ++word) {
+        if ((words_[word] & other.words_[word]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CategorySet::empty() const
+{
+    for (std::vector<unsigned long>::const_iterator word = words_.begin(); word != words_.end(); ++word) {
+        if (*word != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace amm
@@ -19,6 +19,7 @@
 #include "command_line_options_parser.h"
 
 #include <getopt.h>
+#include <cstdlib>
 #include <string>
 #include <vector>
 
@@ -42,6 +43,15 @@ AmmOptions CommandLineOptionsParser::parse(int argc, char* const* argv)
         {"verbose",         no_argument,       0,             'v'},
         {"iconize",         optional_argument, 0,              0 },
         {"no-backup",       optional_argument, 0,              0 },
+        {"keep-backups",    required_argument, 0,              0 },
+        {"if-changed",      no_argument,       0,              0 },
+        {"timings",         optional_argument, 0,              0 },
+        {"trace",           required_argument, 0,              0 },
+        {"report",          required_argument, 0,              0 },
+        {"daemon",          optional_argument, 0,              0 },
+        {"client",          optional_argument, 0,              0 },
+        {"dynamic",         optional_argument, 0,              0 },
+        {"batch",           required_argument, 0,              0 },
         {"output-file",     required_argument, 0,             'o'},
         {"input-directory", required_argument, 0,             'i'},
         {"category-file",   required_argument, 0,             'c'},
@@ -79,6 +89,40 @@ AmmOptions CommandLineOptionsParser::parse(int argc, char* const* argv)
             if (long_option_name == "no-backup") {
                 amm_options.is_backup = false;
             }
+            if (long_option_name == "keep-backups") {
+                amm_options.is_backup_limited = true;
+                if (!parseCount(optarg, &amm_options.backups_to_keep)) {
+                    amm_options.is_parsed = false;
+                }
+            }
+            if (long_option_name == "if-changed") {
+                amm_options.is_if_changed = true;
+            }
+            if (long_option_name == "timings") {
+                amm_options.timings_format = optarg ? optarg : "table";
+            }
+            if (long_option_name == "trace") {
+                amm_options.trace_file_name = optarg;
+            }
+            if (long_option_name == "report") {
+                amm_options.report_format = optarg;
+            }
+            if (long_option_name == "daemon" || long_option_name == "client") {
+                amm_options.is_daemon = amm_options.is_daemon || long_option_name == "daemon";
+                amm_options.is_client = amm_options.is_client || long_option_name == "client";
+                if (optarg) {
+                    amm_options.socket_name = optarg;
+                }
+            }
+            if (long_option_name == "dynamic") {
+                amm_options.is_dynamic = true;
+                if (optarg) {
+                    amm_options.dynamic_subcategory_name = optarg;
+                }
+            }
+            if (long_option_name == "batch") {
+                amm_options.batch_file_name = optarg;
+            }
         } else if (chosen_option == 'o') {
             amm_options.output_file_name = optarg;
         } else if (chosen_option == 'i') {
@@ -96,6 +140,15 @@ AmmOptions CommandLineOptionsParser::parse(int argc, char* const* argv)
     return amm_options;
 }
 
+bool CommandLineOptionsParser::parseCount(const std::string &text, size_t *count) const
+{
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    *count = strtoul(text.c_str(), NULL, 10);
+    return true;
+}
+
 void CommandLineOptionsParser::allowMultipleEntries() const
 {
     // Allow getopt_long() to be called multiple times
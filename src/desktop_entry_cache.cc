@@ -0,0 +1,53 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "desktop_entry_cache.h"
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "filex.h"
+#include "xdg/desktop_entry.h"
+#include "xdg/locale.h"
+
+namespace amm {
+
+// A file that could not be read is remembered without entries
+void DesktopEntryCache::load(const std::vector<std::string> &file_names, const std::vector<xdg::Locale> &locales)
+{
+    std::vector<std::string> lines;
+    for (std::vector<std::string>::const_iterator name = file_names.begin(); name != file_names.end(); ++name) {
+        std::vector<xdg::DesktopEntry> &entries = entries_by_file_name_[*name];
+        if (FileX(*name).readLines(&lines)) {
+            entries = xdg::DesktopEntry::ParsedForEach(lines, locales);
+        }
+    }
+}
+
+// The entries are in the order of the locales they were loaded in, or NULL when the file was never loaded
+const std::vector<xdg::DesktopEntry> *DesktopEntryCache::find(const std::string &file_name) const
+{
+    std::map< std::string, std::vector<xdg::DesktopEntry> >::const_iterator entries = entries_by_file_name_.find(file_name);
+    if (entries == entries_by_file_name_.end()) {
+        return NULL;
+    }
+    return &entries->second;
+}
+
+} // namespace amm
@@ -29,11 +29,10 @@
 
 namespace amm {
 
-static std::vector<std::string> defaultDirectories()
+static std::vector<std::string> existingDirectories(const std::vector<std::string> &directories)
 {
     std::vector<std::string> existing_directories;
-    std::vector<std::string> directories = SystemEnvironment().applicationDirectories();
-    for (std::vector<std::string>::iterator directory = directories.begin(); directory != directories.end(); ++directory) {
+    for (std::vector<std::string>::const_iterator directory = directories.begin(); directory != directories.end(); ++directory) {
         if (DirectoryX(*directory).isValid()) {
             existing_directories.push_back(*directory);
         }
@@ -43,13 +42,20 @@ static std::vector<std::string> defaultDirectories()
 
 void DesktopEntryFileSearch::registerDefaultDirectories()
 {
-    registerDirectories(defaultDirectories());
+    registerDirectories(existingDirectories(SystemEnvironment().applicationDirectories()));
+}
+
+// Leaves out the applications directory under $HOME
+void DesktopEntryFileSearch::registerSystemDirectories()
+{
+    registerDirectories(existingDirectories(SystemEnvironment().systemApplicationDirectories()));
 }
 
 void DesktopEntryFileSearch::resolve()
 {
     desktop_file_names_.clear();
     bad_paths_.clear();
+    visited_directory_names_.clear();
 
     std::vector<std::string> terminated_names = VectorX(directory_names_).terminateEachWith("/");
     std::vector<std::string> unique_names = VectorX(terminated_names).unique();
@@ -67,6 +73,7 @@ void DesktopEntryFileSearch::populate(const std::string &directory_name)
         bad_paths_.push_back(directory_name);
         return;
     }
+    visited_directory_names_.push_back(directory_name);
 
     DirectoryX::Entries entries = directory.allEntries();
 
@@ -23,10 +23,12 @@
 
 #include "stringx.h"
 #include "filex.h"
+#include "io_counters.h"
 
 namespace amm {
 bool DirectoryX::isValid() const
 {
+    ++IoCounters::Process().opendir_calls;
     DIR* directory = opendir(path_.c_str());
     if (directory) {
         closedir(directory);
@@ -38,6 +40,7 @@ bool DirectoryX::isValid() const
 
 DirectoryX::Entries::Entries(const std::string &path) : path_(path)
 {
+    ++IoCounters::Process().opendir_calls;
     directory_ = opendir(path.c_str());
 }
 
@@ -48,13 +51,26 @@ DirectoryX::Entries::~Entries()
     }
 }
 
+// The type reported by readdir saves a stat per entry, except for symbolic links and file systems that don't report it
+static bool isDirectoryEntry(const std::string &path, const dirent *entry)
+{
+#ifdef _DIRENT_HAVE_D_TYPE
+    if (entry->d_type != DT_UNKNOWN && entry->d_type != DT_LNK) {
+        return entry->d_type == DT_DIR;
+    }
+#endif
+    return FileX(StringX(path).terminateWith("/") + entry->d_name).existsAsDirectory();
+}
+
 DirectoryX::Entries::SearchResult DirectoryX::Entries::nextName()
 {
-    dirent *entry_;
-    while((entry_ = readdir(directory_)) != NULL) {
-        std::string full_path = StringX(path_).terminateWith("/") + entry_->d_name;
-        current_result_ = SearchResult::Success(entry_->d_name, FileX(full_path).existsAsDirectory());
-        return current_result_;
+    if (directory_ != NULL) {
+        ++IoCounters::Process().readdir_calls;
+        dirent *entry_ = readdir(directory_);
+        if (entry_ != NULL) {
+            current_result_ = SearchResult::Success(entry_->d_name, isDirectoryEntry(path_, entry_));
+            return current_result_;
+        }
     }
     current_result_ = SearchResult::Bad();
     return current_result_;
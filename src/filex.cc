@@ -19,21 +19,31 @@
 #include "filex.h"
 
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <climits>
 #include <cstdio>
+#include <cstdlib>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <fstream> // TODO : enable optional cstdio integration
 
+#include "io_counters.h"
+
 namespace amm {
 
 bool FileX::exists() const
 {
+    ++IoCounters::Process().stat_calls;
     struct stat st;
     return stat(name_.c_str(), &st) == 0;
 }
 
 bool FileX::existsAsDirectory() const
 {
+    ++IoCounters::Process().stat_calls;
     struct stat st;
     int result = stat(name_.c_str(), &st);
     return result == 0 && S_ISDIR(st.st_mode);
@@ -46,6 +56,7 @@ bool FileX::moveTo(const std::string &new_path) const
 
 bool FileX::readLines(std::vector<std::string> *lines) const
 {
+    ++IoCounters::Process().open_calls;
     std::ifstream file(name_.c_str());
     if (!file.good()) {
         return false;
@@ -54,6 +65,7 @@ bool FileX::readLines(std::vector<std::string> *lines) const
     lines->clear();
     std::string line;
     while (std::getline(file, line)) {
+        IoCounters::Process().bytes_read += line.size() + (file.eof() ? 0 : 1);
         lines->push_back(line);
     }
     file.close();
@@ -66,6 +78,7 @@ bool FileX::writeLines(const std::vector<std::string> &lines) const
         return false;
     }
 
+    ++IoCounters::Process().open_calls;
     std::ofstream file(name_.c_str());
     if (!file.good()) {
         return false;
@@ -78,6 +91,115 @@ bool FileX::writeLines(const std::vector<std::string> &lines) const
     return true;
 }
 
+bool FileX::write(const std::string &content) const
+{
+    if (exists()) {
+        return false;
+    }
+
+    ++IoCounters::Process().open_calls;
+    std::ofstream file(name_.c_str(), std::ios::binary);
+    if (!file.good()) {
+        return false;
+    }
+
+    file.write(content.data(), content.size());
+    return file.good();
+}
+
+bool FileX::read(std::string *content) const
+{
+    ++IoCounters::Process().open_calls;
+    std::ifstream file(name_.c_str(), std::ios::binary);
+    if (!file.good()) {
+        return false;
+    }
+
+    content->clear();
+    char buffer[8192];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        content->append(buffer, file.gcount());
+    }
+    IoCounters::Process().bytes_read += content->size();
+    return !file.bad();
+}
+
+// Follows symbolic links, relative ones from the directory of the link, up to the file they lead to,
+// which may not exist yet. A loop of links is left unresolved.
+static std::string linkTarget(const std::string &name)
+{
+    std::string target = name;
+    for (int hops = 0; hops < 40; ++hops) {
+        struct stat st;
+        ++IoCounters::Process().stat_calls;
+        if (lstat(target.c_str(), &st) != 0 || !S_ISLNK(st.st_mode)) {
+            return target;
+        }
+        std::vector<char> link(st.st_size > 0 ? st.st_size + 1 : PATH_MAX);
+        ssize_t size = readlink(target.c_str(), &link[0], link.size());
+        if (size <= 0 || static_cast<size_t>(size) >= link.size()) {
+            return target;
+        }
+        std::string destination(&link[0], size);
+        if (destination[0] != '/') {
+            size_t slash = target.rfind('/');
+            destination = (slash == std::string::npos ? "" : target.substr(0, slash + 1)) + destination;
+        }
+        target = destination;
+    }
+    return name;
+}
+
+// A symbolic link is written through, replacing the file it leads to rather than the link itself.
+// The content goes to a temporary file next to this one, which is then renamed over it.
+// Anyone reading the file sees either the old or the new content, never a missing or partial file.
+// The temporary file is created with mode 0666, so the kernel applies the umask, and takes the mode of the file it replaces.
+// Its content is synced to disk before the rename, so a crash also leaves the old or the new content.
+bool FileX::replaceWith(const std::string &content) const
+{
+    static unsigned int attempts = 0;
+    const std::string target_name = linkTarget(name_);
+    std::string temporary_name;
+    int descriptor = -1;
+    for (int retries = 0; descriptor == -1 && retries < 100; ++retries) {
+        std::stringstream suffix;
+        suffix << "." << getpid() << "." << attempts++;
+        temporary_name = target_name + suffix.str();
+        ++IoCounters::Process().open_calls;
+        descriptor = open(temporary_name.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+        if (descriptor == -1 && errno != EEXIST) {
+            return false;
+        }
+    }
+    if (descriptor == -1) {
+        return false;
+    }
+
+    struct stat st;
+    bool written = true;
+    ++IoCounters::Process().stat_calls;
+    if (stat(target_name.c_str(), &st) == 0) {
+        written = fchmod(descriptor, st.st_mode & 07777) == 0;
+    }
+
+    size_t offset = 0;
+    while (written && offset < content.size()) {
+        ssize_t count = ::write(descriptor, content.data() + offset, content.size() - offset);
+        if (count > 0) {
+            offset += static_cast<size_t>(count);
+        } else {
+            written = false;
+        }
+    }
+    written = written && fsync(descriptor) == 0;
+
+    if (close(descriptor) != 0 || !written || rename(temporary_name.c_str(), target_name.c_str()) != 0) {
+        remove(temporary_name.c_str());
+        return false;
+    }
+    return true;
+}
+
 bool FileX::purge() const
 {
     return remove(name_.c_str()) == 0;
@@ -0,0 +1,136 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fingerprint.h"
+
+#include <sys/stat.h>
+#include <stdint.h>
+#include <clocale>
+#include <cstdio>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "stringx.h"
+#include "filex.h"
+#include "directoryx.h"
+#include "io_counters.h"
+#include "xdg/icon_theme.h"
+
+namespace amm {
+
+// 64-bit FNV-1a, good enough to notice a change and cheap to compute
+static const uint64_t kOffsetBasis = 14695981039346656037ULL;
+static const uint64_t kPrime = 1099511628211ULL;
+
+Fingerprint::Fingerprint() : hash_(kOffsetBasis)
+{
+}
+
+void Fingerprint::addBytes(const char *bytes, size_t size)
+{
+    for (size_t index = 0; index < size; ++index) {
+        hash_ ^= static_cast<unsigned char>(bytes[index]);
+        hash_ *= kPrime;
+    }
+}
+
+void Fingerprint::addText(const std::string &text)
+{
+    // The terminating NUL keeps "ab" + "c" apart from "a" + "bc"
+    addBytes(text.c_str(), text.size() + 1);
+}
+
+void Fingerprint::addModificationTime(const std::string &path)
+{
+    addText(path);
+
+    struct stat path_stat;
+    ++IoCounters::Process().stat_calls;
+    if (stat(path.c_str(), &path_stat) != 0) {
+        addText("-");
+        return;
+    }
+    char modification_time[64];
+    int size = snprintf(modification_time, sizeof(modification_time), "%ld.%09ld",
+                        static_cast<long>(path_stat.st_mtim.tv_sec), static_cast<long>(path_stat.st_mtim.tv_nsec));
+    addBytes(modification_time, size + 1);
+}
+
+// Menu entries are sorted in the order of the collation locale, which the language alone doesn't decide
+void Fingerprint::addCollation()
+{
+    const char *collation = setlocale(LC_COLLATE, NULL);
+    addText(collation == NULL ? "" : collation);
+}
+
+// Icons sit in the directories an index.theme lists, one or two levels below the theme,
+// so their modification times are the ones that change when an icon is added or removed.
+// A theme may be spread over several theme directories while only one of them has its index.
+void Fingerprint::addIconThemes(const std::vector<std::string> &theme_directories)
+{
+    std::map< std::string, std::vector<std::string> > themes_by_directory;
+    std::map< std::string, std::set<std::string> > subdirectories_by_theme;
+    for (std::vector<std::string>::const_iterator name = theme_directories.begin(); name != theme_directories.end(); ++name) {
+        addModificationTime(*name);
+        DirectoryX directory(*name);
+        if (!directory.isValid()) {
+            continue;
+        }
+        DirectoryX::Entries entries = directory.allEntries();
+        for (DirectoryX::Entries::iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+            std::string theme_name = entry->name();
+            if (!entry->isDirectory() || theme_name == "." || theme_name == "..") {
+                continue;
+            }
+            std::string theme_path = StringX(*name).terminateWith("/") + theme_name;
+            addModificationTime(theme_path);
+            themes_by_directory[*name].push_back(theme_name);
+
+            std::vector<std::string> lines;
+            if (FileX(theme_path + "/index.theme").readLines(&lines)) {
+                addModificationTime(theme_path + "/index.theme");
+                std::vector<xdg::IconSubdirectory> subdirectories = xdg::IconTheme(lines).directories();
+                for (std::vector<xdg::IconSubdirectory>::const_iterator subdirectory = subdirectories.begin(); subdirectory != subdirectories.end(); ++subdirectory) {
+                    subdirectories_by_theme[theme_name].insert(subdirectory->name());
+                }
+            }
+        }
+    }
+
+    for (std::vector<std::string>::const_iterator name = theme_directories.begin(); name != theme_directories.end(); ++name) {
+        const std::vector<std::string> &theme_names = themes_by_directory[*name];
+        for (std::vector<std::string>::const_iterator theme_name = theme_names.begin(); theme_name != theme_names.end(); ++theme_name) {
+            const std::set<std::string> &subdirectories = subdirectories_by_theme[*theme_name];
+            std::string theme_path = StringX(*name).terminateWith("/") + *theme_name + "/";
+            for (std::set<std::string>::const_iterator subdirectory = subdirectories.begin(); subdirectory != subdirectories.end(); ++subdirectory) {
+                addModificationTime(theme_path + *subdirectory);
+            }
+        }
+    }
+}
+
+std::string Fingerprint::hex() const
+{
+    char digest[17];
+    snprintf(digest, sizeof(digest), "%016llx", static_cast<unsigned long long>(hash_));
+    return digest;
+}
+
+} // namespace amm
@@ -0,0 +1,84 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "home_owner.h"
+
+#include <grp.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include "io_counters.h"
+
+namespace amm {
+
+// The group goes first, since an unprivileged user may no longer change it
+HomeOwner::HomeOwner(const std::string &home_name) : is_assumed_(true), is_switched_(false), saved_uid_(geteuid()), saved_gid_(getegid())
+{
+    if (saved_uid_ != 0) {
+        return;
+    }
+
+    struct stat home_stat;
+    ++IoCounters::Process().stat_calls;
+    if (stat(home_name.c_str(), &home_stat) != 0) {
+        is_assumed_ = false;
+        return;
+    }
+
+    int group_count = getgroups(0, NULL);
+    if (group_count > 0) {
+        saved_groups_.resize(group_count);
+        group_count = getgroups(group_count, &saved_groups_[0]);
+    }
+    if (group_count < 0) {
+        is_assumed_ = false;
+        return;
+    }
+    saved_groups_.resize(group_count);
+
+    is_switched_ = true;
+    gid_t home_gid = home_stat.st_gid;
+    if (setgroups(1, &home_gid) != 0 || setegid(home_gid) != 0 || seteuid(home_stat.st_uid) != 0) {
+        restore();
+        is_assumed_ = false;
+    }
+}
+
+HomeOwner::~HomeOwner()
+{
+    restore();
+}
+
+void HomeOwner::restore()
+{
+    if (!is_switched_) {
+        return;
+    }
+    if (seteuid(saved_uid_) != 0
+        || setgroups(saved_groups_.size(), saved_groups_.empty() ? NULL : &saved_groups_[0]) != 0
+        || setegid(saved_gid_) != 0) {
+        // Carrying on as another user would write the remaining homes with the wrong owner
+        _exit(1);
+    }
+    is_switched_ = false;
+}
+
+} // namespace amm
@@ -143,6 +143,15 @@ XdgSearch::XdgSearch(int size, QualifiedIconTheme qualified_icon_theme) : size_(
     icon_themes_ = qualified_icon_theme.themeWithParent();
 }
 
+// Searches other directories for themes already read, without reading their index files again
+XdgSearch::XdgSearch(int size, const std::vector<std::string> &theme_search_paths, const std::vector<xdg::IconTheme> &icon_themes)
+    : size_(size), theme_search_paths_(theme_search_paths), icon_themes_(icon_themes)
+{
+    registered_extensions_.push_back(".png");
+    registered_extensions_.push_back(".svg");
+    registered_extensions_.push_back(".xpm");
+}
+
 std::string XdgSearch::resolvedName(const std::string &icon_name) const
 {
     std::string file_name = ComplaintSearch(icon_themes_, theme_search_paths_, registered_extensions_, size_).nameInTheme(icon_name);
@@ -0,0 +1,54 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "io_counters.h"
+
+#include <sstream>
+#include <string>
+
+namespace amm {
+
+static IoCounters process_counters = {0, 0, 0, 0, 0};
+
+IoCounters &IoCounters::Process()
+{
+    return process_counters;
+}
+
+void IoCounters::reset()
+{
+    stat_calls = 0;
+    open_calls = 0;
+    opendir_calls = 0;
+    readdir_calls = 0;
+    bytes_read = 0;
+}
+
+std::string IoCounters::details() const
+{
+    std::stringstream stream;
+    stream << "File-system calls: "
+           << stat_calls << " stat, "
+           << open_calls << " open, "
+           << opendir_calls << " opendir, "
+           << readdir_calls << " readdir; "
+           << bytes_read << " bytes read";
+    return stream.str();
+}
+
+} // namespace amm
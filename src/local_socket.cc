@@ -0,0 +1,193 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "local_socket.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "io_counters.h"
+
+namespace amm {
+
+LocalSocket::~LocalSocket()
+{
+    if (descriptor_ >= 0) {
+        close(descriptor_);
+        unlink(path_.c_str());
+    }
+}
+
+bool LocalSocket::hasValidPath() const
+{
+    return path_ != "" && path_.size() < sizeof(sockaddr_un().sun_path);
+}
+
+static void limitWaiting(int descriptor)
+{
+    timeval timeout;
+    timeout.tv_sec = LocalSocket::kTimeoutMilliseconds / 1000;
+    timeout.tv_usec = (LocalSocket::kTimeoutMilliseconds % 1000) * 1000;
+    setsockopt(descriptor, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(descriptor, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+bool LocalSocket::connectTo(int descriptor) const
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path_.c_str(), sizeof(address.sun_path) - 1);
+    return connect(descriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+}
+
+// A socket left behind by a server that died is replaced; one still answering is not
+bool LocalSocket::listen()
+{
+    if (!hasValidPath()) {
+        return false;
+    }
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) {
+        return false;
+    }
+    bool is_served = connectTo(probe);
+    close(probe);
+    if (is_served) {
+        return false;
+    }
+    unlink(path_.c_str());
+
+    int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (descriptor < 0) {
+        return false;
+    }
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path_.c_str(), sizeof(address.sun_path) - 1);
+
+    mode_t old_mask = umask(077);
+    bool is_bound = bind(descriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    umask(old_mask);
+    if (!is_bound || ::listen(descriptor, 16) != 0) {
+        close(descriptor);
+        return false;
+    }
+    descriptor_ = descriptor;
+    return true;
+}
+
+// False when no client connected within the timeout, or when the wait was interrupted
+bool LocalSocket::waitForConnection(int timeout_milliseconds) const
+{
+    struct pollfd listener;
+    listener.fd = descriptor_;
+    listener.events = POLLIN;
+    listener.revents = 0;
+    return poll(&listener, 1, timeout_milliseconds) > 0;
+}
+
+int LocalSocket::accept() const
+{
+    int connection;
+    do {
+        connection = ::accept(descriptor_, NULL, NULL);
+    } while (connection < 0 && errno == EINTR);
+    if (connection >= 0) {
+        limitWaiting(connection);
+    }
+    return connection;
+}
+
+// False only when no connection could be accepted; a client that gives up early is simply closed
+bool LocalSocket::answerConnection(LocalSocketResponder &responder) const
+{
+    int connection = accept();
+    if (connection < 0) {
+        return false;
+    }
+    std::string request;
+    if (readAll(connection, &request)) {
+        writeAll(connection, responder.answer(request));
+    }
+    close(connection);
+    return true;
+}
+
+bool LocalSocket::request(const std::string &message, std::string *reply) const
+{
+    if (!hasValidPath()) {
+        return false;
+    }
+    int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (descriptor < 0) {
+        return false;
+    }
+    limitWaiting(descriptor);
+    bool is_answered = connectTo(descriptor) && writeAll(descriptor, message) &&
+                       shutdown(descriptor, SHUT_WR) == 0 && readAll(descriptor, reply);
+    close(descriptor);
+    return is_answered;
+}
+
+// MSG_NOSIGNAL keeps a client hanging up early from ending the server with SIGPIPE
+bool LocalSocket::writeAll(int descriptor, const std::string &content)
+{
+    size_t written = 0;
+    while (written < content.size()) {
+        ssize_t count = send(descriptor, content.data() + written, content.size() - written, MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        written += count;
+    }
+    return true;
+}
+
+bool LocalSocket::readAll(int descriptor, std::string *content)
+{
+    content->clear();
+    char buffer[16384];
+    for (;;) {
+        ssize_t count = read(descriptor, buffer, sizeof(buffer));
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count < 0) {
+            return false;
+        }
+        if (count == 0) {
+            return true;
+        }
+        IoCounters::Process().bytes_read += count;
+        content->append(buffer, count);
+    }
+}
+
+} // namespace amm
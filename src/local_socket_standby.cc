@@ -0,0 +1,78 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "local_socket_standby.h"
+
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+
+#include "local_socket.h"
+
+namespace amm {
+
+// The copy watches a pipe whose write end only the process holds, so it also stops when the process dies
+// It leaves with _exit, keeping the destructors of the process's objects, the socket's included, from running twice
+LocalSocketStandby::LocalSocketStandby(const LocalSocket &socket, LocalSocketResponder &responder)
+    : child_(-1), stop_descriptor_(-1)
+{
+    int stop_pipe[2];
+    if (pipe(stop_pipe) != 0) {
+        return;
+    }
+    child_ = fork();
+    if (child_ < 0) {
+        close(stop_pipe[0]);
+        close(stop_pipe[1]);
+        return;
+    }
+    if (child_ > 0) {
+        close(stop_pipe[0]);
+        stop_descriptor_ = stop_pipe[1];
+        return;
+    }
+
+    close(stop_pipe[1]);
+    for (;;) {
+        struct pollfd stop;
+        stop.fd = stop_pipe[0];
+        stop.events = POLLIN;
+        stop.revents = 0;
+        if (poll(&stop, 1, 0) != 0) {
+            _exit(0);
+        }
+        if (socket.waitForConnection(kStopCheckMilliseconds)) {
+            socket.answerConnection(responder);
+        }
+    }
+}
+
+// Waits for the copy to finish the answer it may be writing
+LocalSocketStandby::~LocalSocketStandby()
+{
+    if (child_ <= 0) {
+        return;
+    }
+    close(stop_descriptor_);
+    int status = 0;
+    while (waitpid(child_, &status, 0) < 0 && errno == EINTR) {
+    }
+}
+
+} // namespace amm
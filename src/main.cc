@@ -16,17 +16,27 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <clocale>
+
 #include "amm.h"
 
 int main(int argc, char *argv[])
 {
+    setlocale(LC_COLLATE, ""); // menu entries are sorted in the collation order of the user
     amm::Amm amm;
     amm.validateEnvironment();
     amm.loadCommandLineOption(argc, argv);
+    amm.runClient();
+    amm.runDaemon();
+    amm.runBatch();
+    amm.readDesktopEntryFiles();
+    amm.exitIfUnchanged();
     amm.registerIconService();
     amm.readCategories();
-    amm.readDesktopEntryFiles();
     amm.populate();
+    amm.printDynamicMenu();
     amm.writeOutputFile();
+    amm.removeOldBackups();
     amm.printSummary();
+    amm.writeTrace();
 }
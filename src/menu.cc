@@ -22,11 +22,15 @@
 #include <vector>
 
 #include "stringx.h"
+#include "category_atoms.h"
+#include "category_set.h"
+#include "category_index.h"
 #include "filex.h"
 #include "icon_search/icon_search_interface.h"
 #include "icon_search/mirror_search.h"
 #include "xdg/desktop_entry.h"
 #include "subcategory.h"
+#include "timings.h"
 #include "representation/menu_start.h"
 #include "representation/menu_end.h"
 #include "representation/subcategory_start.h"
@@ -35,9 +39,8 @@
 
 namespace amm {
 
-Menu::Menu() : icon_searcher_(new icon_search::MirrorSearch), unclassified_subcategory_(Subcategory::Others())
+Menu::Menu() : icon_searcher_(new icon_search::MirrorSearch), unclassified_subcategory_(Subcategory::Others()), classification_type_(INDEXED_CLASSIFICATION), has_categories_(false), timings_(NULL)
 {
-    createDefaultCategories();
 }
 
 Menu::~Menu()
@@ -54,23 +57,32 @@ void Menu::registerIconService(icon_search::IconSearchInterface &icon_searcher)
 void Menu::createDefaultCategories()
 {
     subcategories_.clear();
+    category_atoms_ = CategoryAtoms();
+    category_index_ = CategoryIndex();
 
-    subcategories_.push_back(Subcategory::Settings());
-    subcategories_.push_back(Subcategory::Accessories());
-    subcategories_.push_back(Subcategory::Development());
-    subcategories_.push_back(Subcategory::Education());
-    subcategories_.push_back(Subcategory::Games());
-    subcategories_.push_back(Subcategory::Graphics());
-    subcategories_.push_back(Subcategory::Internet());
-    subcategories_.push_back(Subcategory::Multimedia());
-    subcategories_.push_back(Subcategory::Office());
-    subcategories_.push_back(Subcategory::Science());
-    subcategories_.push_back(Subcategory::System());
+    for (size_t position = 0; position < Subcategory::DefaultCount(); ++position) {
+        addSubcategory(Subcategory::Default(position));
+    }
+    has_categories_ = true;
+}
+
+void Menu::addSubcategory(const Subcategory &subcategory)
+{
+    size_t position = subcategories_.size();
+    subcategories_.push_back(subcategory);
+    subcategories_.back().internClassificationNames(category_atoms_);
+
+    const std::vector<std::string> &names = subcategory.classificationNames();
+    for (std::vector<std::string>::const_iterator name = names.begin(); name != names.end(); ++name) {
+        category_index_.add(category_atoms_.intern(*name), position);
+    }
 }
 
 void Menu::loadCustomCategories(const std::vector<std::string> &lines)
 {
     subcategories_.clear();
+    category_atoms_ = CategoryAtoms();
+    category_index_ = CategoryIndex();
 
     for (std::vector<std::string>::const_iterator line = lines.begin(); line != lines.end(); ++line) {
         if ((*line)[0] != '#') {
@@ -83,33 +95,95 @@ void Menu::loadCustomCategories(const std::vector<std::string> &lines)
                     }
                 }
                 if (classification_names.size() > 0) {
-                    subcategories_.push_back(Subcategory(tokens[0], tokens[1], classification_names));
+                    addSubcategory(Subcategory(tokens[0], tokens[1], classification_names));
                 }
             }
         }
     }
+    has_categories_ = true;
 }
 
+// The default layout is only built when no custom categories were loaded
 void Menu::populate(const std::vector<std::string> &entry_names)
 {
+    PopulateAll(std::vector<Menu*>(1, this), entry_names);
+}
+
+void Menu::PopulateAll(const std::vector<Menu*> &menus, const std::vector<std::string> &entry_names)
+{
+    PopulateAll(menus, entry_names, DesktopEntryCache());
+}
+
+// Reads and scans each desktop file once, in the languages of all the menus
+// Files found among the shared entries, loaded in the same languages, are not read again
+void Menu::PopulateAll(const std::vector<Menu*> &menus, const std::vector<std::string> &entry_names, const DesktopEntryCache &shared_entries)
+{
+    if (menus.empty()) {
+        return;
+    }
+
+    std::vector<xdg::Locale> locales;
+    for (std::vector<Menu*>::const_iterator menu = menus.begin(); menu != menus.end(); ++menu) {
+        (*menu)->startPopulating();
+        locales.push_back((*menu)->locale_);
+    }
+
+    Timings *timings = menus.front()->timings_;
+    std::vector<std::string> lines;
+    std::vector<xdg::DesktopEntry> parsed_entries;
     for (std::vector<std::string>::const_iterator name = entry_names.begin(); name != entry_names.end(); ++name) {
-        addDesktopEntry(*name);
+        const std::vector<xdg::DesktopEntry> *entries = shared_entries.find(*name);
+        if (entries == NULL) {
+            TimedPhase phase(timings, "parse", *name);
+            parsed_entries.clear();
+            if (FileX(*name).readLines(&lines)) {
+                parsed_entries = xdg::DesktopEntry::ParsedForEach(lines, locales);
+            }
+            entries = &parsed_entries;
+        }
+
+        if (entries->size() != menus.size()) {
+            for (std::vector<Menu*>::const_iterator menu = menus.begin(); menu != menus.end(); ++menu) {
+                (*menu)->summary_.addUnparsedFile(*name);
+            }
+            continue;
+        }
+        for (size_t position = 0; position < menus.size(); ++position) {
+            menus[position]->addDesktopEntry(*name, (*entries)[position]);
+        }
     }
 
-    subcategories_.push_back(unclassified_subcategory_);
+    for (std::vector<Menu*>::const_iterator menu = menus.begin(); menu != menus.end(); ++menu) {
+        (*menu)->finishPopulating();
+    }
 }
 
-void Menu::addDesktopEntry(const std::string &entry_name)
+void Menu::startPopulating()
 {
-    std::vector<std::string> lines;
-    if (!FileX(entry_name).readLines(&lines)) {
-        summary_.addUnparsedFile(entry_name);
-        return;
+    if (!has_categories_) {
+        createDefaultCategories();
     }
-    xdg::DesktopEntry entry;
-    entry.hasLanguage(language_);
-    entry.parse(lines);
+}
 
+void Menu::finishPopulating()
+{
+    subcategories_.push_back(unclassified_subcategory_);
+}
+
+// Forgets the desktop files and categories, keeping the icon service, language and classification type
+void Menu::clear()
+{
+    subcategories_.clear();
+    desktop_entries_.clear();
+    category_atoms_ = CategoryAtoms();
+    category_index_ = CategoryIndex();
+    unclassified_subcategory_ = Subcategory::Others();
+    has_categories_ = false;
+    summary_ = Stats();
+}
+
+void Menu::addDesktopEntry(const std::string &entry_name, const xdg::DesktopEntry &entry)
+{
     if (!entry.display()) {
         summary_.addSuppressedFile(entry_name);
         return;
@@ -120,37 +194,83 @@ void Menu::addDesktopEntry(const std::string &entry_name)
         return;
     }
 
+    TimedPhase classify_phase(timings_, "classify");
     bool classified = classify(entry);
     if (classified) {
         summary_.addClassifiedFile(entry_name);
     } else {
-        unclassified_subcategory_.addDesktopEntry(entry);
         summary_.addUnclassifiedFile(entry_name);
         summary_.addUnhandledClassifications(entry.categories());
     }
 }
 
+// The entry is stored once in the pool, whichever number of subcategories list it
 bool Menu::classify(const xdg::DesktopEntry &entry)
 {
-    bool classified = false;
+    if (classification_type_ == INDEXED_CLASSIFICATION) {
+        matchByIndex(entry);
+    } else {
+        matchByScan(entry);
+    }
 
-    std::vector<Subcategory>::iterator subcategory;
-    for (subcategory = subcategories_.begin(); subcategory != subcategories_.end(); ++subcategory) {
-        if (entry.isAnyOf(subcategory->classificationNames())) {
-            classified = true;
-            subcategory->addDesktopEntry(entry);
+    size_t position = desktop_entries_.size();
+    desktop_entries_.push_back(entry);
+
+    if (matching_subcategories_.empty()) {
+        unclassified_subcategory_.addDesktopEntry(position);
+        return false;
+    }
+
+    for (std::vector<size_t>::const_iterator subcategory = matching_subcategories_.begin(); subcategory != matching_subcategories_.end(); ++subcategory) {
+        subcategories_[*subcategory].addDesktopEntry(position);
+    }
+    return true;
+}
+
+void Menu::matchByScan(const xdg::DesktopEntry &entry)
+{
+    matching_subcategories_.clear();
+    CategorySet categories = category_atoms_.knownOf(entry.categories());
+    if (categories.empty()) {
+        return;
+    }
+
+    for (size_t position = 0; position < subcategories_.size(); ++position) {
+        if (subcategories_[position].classifies(categories)) {
+            matching_subcategories_.push_back(position);
         }
     }
+}
 
-    return classified;
+// Visits only the subcategories that claim one of the categories of the entry
+void Menu::matchByIndex(const xdg::DesktopEntry &entry)
+{
+    category_index_.subcategoriesFor(entry.categories(), category_atoms_, &matching_subcategories_);
 }
 
+// Each entry is collated once, however many subcategories list it
 void Menu::sort()
 {
+    std::vector<std::string> collation_keys;
+    collation_keys.reserve(desktop_entries_.size());
+    for (std::vector<xdg::DesktopEntry>::const_iterator entry = desktop_entries_.begin(); entry != desktop_entries_.end(); ++entry) {
+        collation_keys.push_back(entry->collationKey());
+    }
+
     std::vector<Subcategory>::iterator group;
     for (group = subcategories_.begin(); group != subcategories_.end(); ++group) {
-        group->sortDesktopEntries();
+        group->sortDesktopEntries(collation_keys);
+    }
+}
+
+std::vector<xdg::DesktopEntry> Menu::desktopEntriesOf(const Subcategory &subcategory) const
+{
+    std::vector<xdg::DesktopEntry> entries;
+    const std::vector<size_t> &positions = subcategory.desktopEntryPositions();
+    for (std::vector<size_t>::const_iterator position = positions.begin(); position != positions.end(); ++position) {
+        entries.push_back(desktop_entries_[*position]);
     }
+    return entries;
 }
 
 std::vector<representation::RepresentationInterface*> Menu::representations() const
@@ -166,10 +286,11 @@ std::vector<representation::RepresentationInterface*> Menu::representations() co
             representation::SubcategoryStart *start = new representation::SubcategoryStart(subcategory->displayName(), icon_name);
             representations.push_back(start);
 
-            std::vector<xdg::DesktopEntry> entries = subcategory->desktopEntries();
-            for (std::vector<xdg::DesktopEntry>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry) {
-                std::string icon_name = icon_searcher_->resolvedName(entry->icon());
-                representation::Program *program = new representation::Program(entry->name(), icon_name, entry->executable(), entry->comment());
+            const std::vector<size_t> &positions = subcategory->desktopEntryPositions();
+            for (std::vector<size_t>::const_iterator position = positions.begin(); position != positions.end(); ++position) {
+                const xdg::DesktopEntry &entry = desktop_entries_[*position];
+                std::string icon_name = icon_searcher_->resolvedName(entry.icon());
+                representation::Program *program = new representation::Program(entry.name(), icon_name, entry.executable(), entry.comment());
                 representations.push_back(program);
             }
 
@@ -183,4 +304,47 @@ std::vector<representation::RepresentationInterface*> Menu::representations() co
     return representations;
 }
 
+// Walks the same model as representations(), without building a node per line
+void Menu::stream(transformer::StreamTransformerInterface &transformer) const
+{
+    transformer.menuStart(representation::MenuStart().name());
+
+    std::vector<Subcategory>::const_iterator subcategory;
+    for (subcategory = subcategories_.begin(); subcategory != subcategories_.end(); ++subcategory) {
+        if (subcategory->hasEntries()) {
+            transformer.subcategoryStart(subcategory->displayName(), icon_searcher_->resolvedName(subcategory->iconName()));
+
+            const std::vector<size_t> &positions = subcategory->desktopEntryPositions();
+            for (std::vector<size_t>::const_iterator position = positions.begin(); position != positions.end(); ++position) {
+                const xdg::DesktopEntry &entry = desktop_entries_[*position];
+                transformer.program(entry.name(), icon_searcher_->resolvedName(entry.icon()), entry.executable(), entry.comment());
+            }
+
+            transformer.subcategoryEnd(subcategory->displayName());
+        }
+    }
+
+    transformer.menuEnd(representation::MenuEnd().name());
+}
+
+// Only the programs of the named subcategory are walked, as the whole of a menu, for JWM to load when it opens
+void Menu::stream(transformer::StreamTransformerInterface &transformer, const std::string &subcategory_name) const
+{
+    transformer.menuStart(representation::MenuStart().name());
+
+    std::vector<Subcategory>::const_iterator subcategory;
+    for (subcategory = subcategories_.begin(); subcategory != subcategories_.end(); ++subcategory) {
+        if (subcategory->displayName() == subcategory_name) {
+            const std::vector<size_t> &positions = subcategory->desktopEntryPositions();
+            for (std::vector<size_t>::const_iterator position = positions.begin(); position != positions.end(); ++position) {
+                const xdg::DesktopEntry &entry = desktop_entries_[*position];
+                transformer.program(entry.name(), icon_searcher_->resolvedName(entry.icon()), entry.executable(), entry.comment());
+            }
+            break;
+        }
+    }
+
+    transformer.menuEnd(representation::MenuEnd().name());
+}
+
 } // namespace amm
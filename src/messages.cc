@@ -41,10 +41,25 @@ std::string help()
     stream << std::endl;
 
     stream << "Optional arguments:" << std::endl;
+    stream << "      --batch=[FILE]          Write a menu into each home directory listed in" << std::endl;
+    stream << "                                FILE, one per line, named as the output file." << std::endl;
+    stream << "                                System-wide desktop files and icons are read" << std::endl;
+    stream << "                                once for all of them." << std::endl;
     stream << "  -c, --category-file=[FILE]  Use an external category file. This overrides the" << std::endl;
     stream << "                                built in categories. Please look at" << std::endl;
     stream << "                                default.mjwm to write your own category files." << std::endl;
+    stream << "      --client=[SOCKET]       Write the menu served by a daemon, without reading" << std::endl;
+    stream << "                                any desktop file. [Default: $HOME/.mjwm-socket]" << std::endl;
+    stream << "      --daemon=[SOCKET]       Keep the menu in memory and serve it to clients," << std::endl;
+    stream << "                                reading the inputs again only when they" << std::endl;
+    stream << "                                changed. [Default: $HOME/.mjwm-socket]" << std::endl;
+    stream << "      --dynamic=[SUBCATEGORY] Print the menu, or only the programs of one" << std::endl;
+    stream << "                                subcategory, for a JWM Dynamic menu. With" << std::endl;
+    stream << "                                --client, a daemon answers it." << std::endl;
     stream << "      --help                  Show this help." << std::endl;
+    stream << "      --if-changed            Exit early, leaving the output file alone, when" << std::endl;
+    stream << "                                no input directory, icon theme, category" << std::endl;
+    stream << "                                file or option changed since it was made." << std::endl;
     stream << "      --iconize=[THEME]       Search for icon files by name in $HOME," << std::endl;
     stream << "                                $XDG_DATA_DIRS/icons, and /usr/share/pixmaps." << std::endl;
     stream << "                                Icon file names would be absolute paths to" << std::endl;
@@ -57,8 +72,25 @@ std::string help()
     stream << "                                colons. [Default: application directories" << std::endl;
     stream << "                                under $XDG_DATA_HOME & $XDG_DATA_DIRS]" << std::endl;
     stream << "      --language=[NAME]       The language for which the menu would be build." << std::endl;
-    stream << "                                Defaults to the system default." << std::endl;
+    stream << "                                Accepts locales like sr_RS@latin, falling" << std::endl;
+    stream << "                                back to sr_RS, sr@latin and sr in order." << std::endl;
+    stream << "                                Several languages, separated by colons, are" << std::endl;
+    stream << "                                built in one run, each into the output file" << std::endl;
+    stream << "                                suffixed with its language, as in" << std::endl;
+    stream << "                                .jwmrc-mjwm.de. Defaults to the system default." << std::endl;
+    stream << "      --keep-backups=[N]      Keep only the N most recent backup files, removing" << std::endl;
+    stream << "                                older ones." << std::endl;
     stream << "      --no-backup             Do not create any backup files." << std::endl;
+    stream << "      --report=[FORMAT]       Print the outcome of the run, its totals," << std::endl;
+    stream << "                                categories, skipped files, icon hit rates" << std::endl;
+    stream << "                                and timings as one document instead of the" << std::endl;
+    stream << "                                summary. The only format is json." << std::endl;
+    stream << "      --timings=[FORMAT]      Show the time spent in each phase of the run." << std::endl;
+    stream << "                                Acceptable formats are table and json." << std::endl;
+    stream << "                                Defaults to table." << std::endl;
+    stream << "      --trace=[FILE]          Write the phases of the run, every desktop file" << std::endl;
+    stream << "                                parsed and every icon resolved as a Chrome" << std::endl;
+    stream << "                                trace-event file." << std::endl;
     stream << "  -v  --verbose               Verbose output." << std::endl;
     stream << "      --version               Show version information." << std::endl;
     stream << std::endl;
@@ -97,6 +129,20 @@ std::string badSummaryType(const std::string &actual)
     return stream.str();
 }
 
+std::string badTimingsFormat(const std::string &actual)
+{
+    std::stringstream stream;
+    stream << actual << " is not a valid timings format" << std::endl << optionError();
+    return stream.str();
+}
+
+std::string badReportFormat(const std::string &actual)
+{
+    std::stringstream stream;
+    stream << actual << " is not a valid report format" << std::endl << optionError();
+    return stream.str();
+}
+
 std::string badInputPaths(const std::string &bad_paths)
 {
     std::stringstream stream;
@@ -144,5 +190,108 @@ std::string backupFile(const std::string &file_name, const std::string &backup_f
     return stream.str();
 }
 
+std::string badBackupFile(const std::string &backup_file_name)
+{
+    std::stringstream stream;
+    stream << "Couldn't create backup file: " << backup_file_name;
+    return stream.str();
+}
+
+std::string badTraceFile(const std::string &file_name)
+{
+    std::stringstream stream;
+    stream << "Couldn't create trace file: " << file_name;
+    return stream.str();
+}
+
+std::string removedBackupFiles(const std::string &file_name, size_t count)
+{
+    std::stringstream stream;
+    stream << "Removed " << count << " old backup" << (count == 1 ? "" : "s") << " of " << file_name;
+    return stream.str();
+}
+
+std::string createdOutputFile(const std::string &file_name)
+{
+    return "Created " + file_name;
+}
+
+std::string unchangedOutputFile(const std::string &file_name)
+{
+    return "Unchanged " + file_name + ", the menu is the same";
+}
+
+std::string fingerprintOf(const std::string &digest)
+{
+    return "<!-- Fingerprint: " + digest + " -->";
+}
+
+std::string unchangedInputs(const std::string &file_name)
+{
+    return "Unchanged " + file_name + ", the inputs are the same";
+}
+
+std::string daemonWithClient()
+{
+    std::stringstream stream;
+    stream << "--daemon and --client can't be used together" << std::endl << optionError();
+    return stream.str();
+}
+
+std::string daemonWithRunReports()
+{
+    std::stringstream stream;
+    stream << "--trace, --timings and --report can't be used with --daemon, which never ends" << std::endl << optionError();
+    return stream.str();
+}
+
+std::string badSocket(const std::string &socket_name)
+{
+    return "Couldn't serve menus on " + socket_name + ", it is already served or can't be created";
+}
+
+std::string servingMenus(const std::string &socket_name)
+{
+    return "Serving menus on " + socket_name;
+}
+
+std::string noDaemon(const std::string &socket_name)
+{
+    return "No menu daemon answered on " + socket_name;
+}
+
+std::string languagesWithSingleMenuOptions()
+{
+    std::stringstream stream;
+    stream << "Several languages can't be used with --report, --daemon, --client or --dynamic" << std::endl << optionError();
+    return stream.str();
+}
+
+std::string batchWithSingleRunOptions()
+{
+    std::stringstream stream;
+    stream << "--batch can't be used with --if-changed, --report, --daemon, --client or --dynamic" << std::endl << optionError();
+    return stream.str();
+}
+
+std::string badBatchFile(const std::string &file_name)
+{
+    std::stringstream stream;
+    stream << "Couldn't open batch file: " << file_name;
+    return stream.str();
+}
+
+std::string badHomeOwner(const std::string &home_name)
+{
+    std::stringstream stream;
+    stream << "Couldn't act as the owner of home directory: " << home_name;
+    return stream.str();
+}
+
+std::string skippedHome(const std::string &home_name)
+{
+    return "Skipped home directory: " + home_name;
+}
+
 } // namespace messages
 } // namespace amm
@@ -30,8 +30,16 @@ namespace amm {
 
 QualifiedIconTheme::QualifiedIconTheme(const SystemEnvironment &environment, const std::string &theme_name) : theme_name_(theme_name)
 {
-    std::vector<std::string> theme_directories = environment.iconThemeDirectories();
+    registerExistingDirectories(environment.iconThemeDirectories());
+}
 
+QualifiedIconTheme::QualifiedIconTheme(const std::vector<std::string> &theme_directories, const std::string &theme_name) : theme_name_(theme_name)
+{
+    registerExistingDirectories(theme_directories);
+}
+
+void QualifiedIconTheme::registerExistingDirectories(const std::vector<std::string> &theme_directories)
+{
     for (std::vector<std::string>::const_iterator dir = theme_directories.begin(); dir != theme_directories.end(); ++dir) {
         if (FileX(*dir).exists()) {
             theme_search_paths_.push_back(*dir);
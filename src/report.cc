@@ -0,0 +1,113 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "report.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "stringx.h"
+#include "stats.h"
+#include "timings.h"
+
+namespace amm {
+
+Report::Report(const std::string &version, const Stats &summary, const Timings &timings) :
+    version_(version), summary_(summary), timings_(timings), removed_backups_(0),
+    icon_lookups_(0), icon_cache_hits_(0), resolved_icon_lookups_(0)
+{
+}
+
+void Report::registerOutput(const std::string &file_name, const std::string &status, const std::string &backup_file_name, size_t removed_backups)
+{
+    output_file_name_ = file_name;
+    output_status_ = status;
+    backup_file_name_ = backup_file_name;
+    removed_backups_ = removed_backups;
+}
+
+void Report::registerIconLookups(size_t lookups, size_t cache_hits, size_t resolved_lookups)
+{
+    icon_lookups_ = lookups;
+    icon_cache_hits_ = cache_hits;
+    resolved_icon_lookups_ = resolved_lookups;
+}
+
+void Report::addCategory(const std::string &name, size_t entries)
+{
+    category_names_.push_back(name);
+    category_entries_.push_back(entries);
+}
+
+static std::string jsonArray(const std::vector<std::string> &items)
+{
+    std::string array = "[";
+    for (std::vector<std::string>::const_iterator item = items.begin(); item != items.end(); ++item) {
+        if (item != items.begin()) {
+            array += ",";
+        }
+        array += StringX(*item).jsonQuoted();
+    }
+    return array + "]";
+}
+
+static double rate(size_t part, size_t whole)
+{
+    return whole == 0 ? 0 : static_cast<double>(part) / whole;
+}
+
+// The lists of suppressed and unclassified files are only filled when the stats retain their details
+std::string Report::json() const
+{
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"version\":" << StringX(version_).jsonQuoted();
+    stream << ",\"output\":{\"file\":" << StringX(output_file_name_).jsonQuoted()
+           << ",\"status\":" << StringX(output_status_).jsonQuoted()
+           << ",\"backup_file\":" << StringX(backup_file_name_).jsonQuoted()
+           << ",\"removed_backups\":" << removed_backups_ << "}";
+    stream << ",\"totals\":{\"files\":" << summary_.totalFiles()
+           << ",\"parsed\":" << summary_.totalParsedFiles()
+           << ",\"unparsed\":" << summary_.totalUnparsedFiles()
+           << ",\"suppressed\":" << summary_.totalSuppressedFiles()
+           << ",\"unclassified\":" << summary_.totalUnclassifiedFiles() << "}";
+    stream << ",\"categories\":[";
+    for (size_t position = 0; position < category_names_.size(); ++position) {
+        if (position > 0) {
+            stream << ",";
+        }
+        stream << "{\"name\":" << StringX(category_names_[position]).jsonQuoted()
+               << ",\"entries\":" << category_entries_[position] << "}";
+    }
+    stream << "]";
+    stream << ",\"unparsed_files\":" << jsonArray(summary_.unparsedFiles())
+           << ",\"suppressed_files\":" << jsonArray(summary_.suppressedFiles())
+           << ",\"unclassified_files\":" << jsonArray(summary_.unclassifiedFiles())
+           << ",\"unhandled_classifications\":" << jsonArray(summary_.unhandledClassifications());
+    stream << ",\"icons\":{\"lookups\":" << icon_lookups_
+           << ",\"cache_hits\":" << icon_cache_hits_
+           << ",\"resolved\":" << resolved_icon_lookups_
+           << ",\"cache_hit_rate\":" << rate(icon_cache_hits_, icon_lookups_)
+           << ",\"resolved_rate\":" << rate(resolved_icon_lookups_, icon_lookups_) << "}";
+    stream << ",\"timings\":" << timings_.json() << "}";
+    return stream.str();
+}
+
+} // namespace amm
@@ -20,36 +20,60 @@
 
 #include <string>
 #include <vector>
+#include <set>
 #include <sstream>
-#include <algorithm>
 
 #include "vectorx.h"
 
 namespace amm {
 
+void Stats::addClassifiedFile(const std::string &)
+{
+    ++classified_count_;
+}
+
+void Stats::addUnclassifiedFile(const std::string &file)
+{
+    ++unclassified_count_;
+    if (is_detailed_) {
+        unclassified_files_.push_back(file);
+    }
+}
+
+void Stats::addSuppressedFile(const std::string &file)
+{
+    ++suppressed_count_;
+    if (is_detailed_) {
+        suppressed_files_.push_back(file);
+    }
+}
+
+// The set keeps the classifications sorted and unique as they arrive
 void Stats::addUnhandledClassifications(const std::vector<std::string> &classifications)
 {
-    unhandled_classifications_.insert(unhandled_classifications_.begin(), classifications.begin(), classifications.end());
+    if (is_detailed_) {
+        unhandled_classifications_.insert(classifications.begin(), classifications.end());
+    }
 }
 
 size_t Stats::totalFiles() const
 {
-    return classified_files_.size() + unclassified_files_.size() + suppressed_files_.size() + unparsed_files_.size();
+    return totalParsedFiles() + suppressed_count_ + unparsed_files_.size();
 }
 
 size_t Stats::totalParsedFiles() const
 {
-    return classified_files_.size() + unclassified_files_.size();
+    return classified_count_ + unclassified_count_;
 }
 
 size_t Stats::totalUnclassifiedFiles() const
 {
-    return unclassified_files_.size();
+    return unclassified_count_;
 }
 
 size_t Stats::totalSuppressedFiles() const
 {
-    return suppressed_files_.size();
+    return suppressed_count_;
 }
 
 size_t Stats::totalUnparsedFiles() const
@@ -57,23 +81,12 @@ size_t Stats::totalUnparsedFiles() const
     return unparsed_files_.size();
 }
 
-std::vector<std::string> Stats::unparsedFiles() const
-{
-    return unparsed_files_;
-}
-
-std::vector<std::string> Stats::unhandledClassifications()
+std::vector<std::string> Stats::unhandledClassifications() const
 {
-    if (unhandled_classifications_.size() > 1) {
-        std::sort(unhandled_classifications_.begin(), unhandled_classifications_.end());
-        std::vector<std::string>::iterator it = std::unique(unhandled_classifications_.begin(), unhandled_classifications_.end());
-        unhandled_classifications_.resize(std::distance(unhandled_classifications_.begin(), it));
-    }
-
-    return unhandled_classifications_;
+    return std::vector<std::string>(unhandled_classifications_.begin(), unhandled_classifications_.end());
 }
 
-std::string Stats::details(const std::string &summary_type)
+std::string Stats::details(const std::string &summary_type) const
 {
     std::stringstream stream;
     stream << "Total desktop files: " << totalFiles() << " ["
@@ -88,15 +101,15 @@ std::string Stats::details(const std::string &summary_type)
     }
 
     if (summary_type == "long") {
-        if (totalSuppressedFiles() > 0) {
+        if (!suppressed_files_.empty()) {
             stream << std::endl << "Suppressed files: " << VectorX(suppressed_files_).join(", ");
         }
 
-        if (totalUnclassifiedFiles() > 0) {
+        if (!unclassified_files_.empty()) {
             stream << std::endl << "Unclassified files: " << VectorX(unclassified_files_).join(", ");
         }
 
-        if (unhandled_classifications_.size() > 0) {
+        if (!unhandled_classifications_.empty()) {
             stream << std::endl << "Unhandled classifications: " << VectorX(unhandledClassifications()).join(", ");
         }
     }
@@ -18,6 +18,13 @@
 
 #include "stringx.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include <clocale>
+#include <cstdio>
+#include <cstring>
+#include <cctype>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -42,19 +49,91 @@ std::string StringX::encode() const
 {
     std::string result;
     result.reserve(string_.size());
+    appendEncodedTo(&result);
+    return result;
+}
+
+static inline bool isEscapable(char character)
+{
+    return character == '&' || character == '"' || character == '\'' || character == '<' || character == '>';
+}
 
-    for(size_t pos = 0; pos != string_.size(); ++pos) {
-        switch(string_[pos]) {
-            case '&' : result.append("&amp;");       break;
-            case '\"': result.append("&quot;");      break;
-            case '\'': result.append("&apos;");      break;
-            case '<' : result.append("&lt;");        break;
-            case '>' : result.append("&gt;");        break;
-            default  : result.append(&string_[pos], 1); break;
+// Finds the first character needing an XML escape at or after start, 16 bytes at a time where SSE2 is available
+static size_t findEscapable(const char *data, size_t start, size_t size)
+{
+    size_t position = start;
+
+#ifdef __SSE2__
+    const __m128i ampersand = _mm_set1_epi8('&');
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i apostrophe = _mm_set1_epi8('\'');
+    const __m128i less = _mm_set1_epi8('<');
+    const __m128i greater = _mm_set1_epi8('>');
+
+    for (; position + 16 <= size; position += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+        __m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, ampersand), _mm_cmpeq_epi8(chunk, quote)),
+                                       _mm_or_si128(_mm_cmpeq_epi8(chunk, apostrophe),
+                                                    _mm_or_si128(_mm_cmpeq_epi8(chunk, less), _mm_cmpeq_epi8(chunk, greater))));
+        int mask = _mm_movemask_epi8(matches);
+        if (mask != 0) {
+            return position + __builtin_ctz(mask);
         }
     }
+#endif
 
-    return result;
+    for (; position < size; ++position) {
+        if (isEscapable(data[position])) {
+            return position;
+        }
+    }
+    return size;
+}
+
+void StringX::appendEncodedTo(std::string *buffer) const
+{
+    appendEncoded(string_, buffer);
+}
+
+// Runs without anything to escape are copied in bulk, so a string with nothing to escape is appended at once
+void StringX::appendEncoded(const std::string &string, std::string *buffer)
+{
+    const char *data = string.data();
+    const size_t size = string.size();
+    size_t run_start = 0;
+
+    for (size_t pos = findEscapable(data, 0, size); pos != size; pos = findEscapable(data, run_start, size)) {
+        buffer->append(data + run_start, pos - run_start);
+        switch(data[pos]) {
+            case '&' : buffer->append("&amp;");  break;
+            case '\"': buffer->append("&quot;"); break;
+            case '\'': buffer->append("&apos;"); break;
+            case '<' : buffer->append("&lt;");   break;
+            case '>' : buffer->append("&gt;");   break;
+        }
+        run_start = pos + 1;
+    }
+
+    buffer->append(data + run_start, size - run_start);
+}
+
+// Control characters become \u escapes; everything else passes through as UTF-8
+std::string StringX::jsonQuoted() const
+{
+    std::string quoted = "\"";
+    for (std::string::const_iterator character = string_.begin(); character != string_.end(); ++character) {
+        if (*character == '"' || *character == '\\') {
+            quoted += '\\';
+            quoted += *character;
+        } else if (static_cast<unsigned char>(*character) < 0x20) {
+            char escaped[7];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*character));
+            quoted += escaped;
+        } else {
+            quoted += *character;
+        }
+    }
+    return quoted + "\"";
 }
 
 std::string StringX::trim() const
@@ -72,6 +151,30 @@ std::string StringX::trim() const
     return string_.substr(begin, range);
 }
 
+// Keys compare with plain byte comparison in the order of the collation locale (LC_COLLATE).
+// The "C" collations (including C.UTF-8) would order by byte value, so ASCII letters are case-folded instead.
+std::string StringX::collationKey() const
+{
+    const char *collation = setlocale(LC_COLLATE, NULL);
+    if (collation == NULL || strcmp(collation, "C") == 0 || strncmp(collation, "C.", 2) == 0 || strcmp(collation, "POSIX") == 0) {
+        std::string result(string_);
+        for (std::string::iterator character = result.begin(); character != result.end(); ++character) {
+            if (*character >= 'A' && *character <= 'Z') {
+                *character = static_cast<char>(tolower(*character));
+            }
+        }
+        return result;
+    }
+
+    std::vector<char> buffer(string_.size() * 4 + 1);
+    size_t length = strxfrm(&buffer[0], string_.c_str(), buffer.size());
+    if (length >= buffer.size()) {
+        buffer.resize(length + 1);
+        strxfrm(&buffer[0], string_.c_str(), buffer.size());
+    }
+    return std::string(&buffer[0], length);
+}
+
 std::vector<std::string> StringX::split(const std::string &delimeter) const
 {
     std::string raw = string_;
@@ -26,6 +26,40 @@
 
 namespace amm {
 
+struct DefaultSubcategory
+{
+    const char *display_name;
+    const char *icon_name;
+    const char *classification_name;
+};
+
+// Constant-initialized, so nothing is allocated until a default subcategory is materialized.
+// The classification names are distinct, hence interning them in this order gives each row its own position as atom.
+static const DefaultSubcategory kDefaultSubcategories[] = {
+    { "Settings",    "gnome-settings",           "Settings"    },
+    { "Accessories", "applications-accessories", "Utility"     },
+    { "Development", "applications-development", "Development" },
+    { "Education",   "applications-science",     "Education"   },
+    { "Games",       "applications-games",       "Game"        },
+    { "Graphics",    "applications-graphics",    "Graphics"    },
+    { "Internet",    "applications-internet",    "Network"     },
+    { "Multimedia",  "applications-multimedia",  "AudioVideo"  },
+    { "Office",      "applications-office",      "Office"      },
+    { "Science",     "applications-science",     "Science"     },
+    { "System",      "applications-system",      "System"      }
+};
+
+size_t Subcategory::DefaultCount()
+{
+    return sizeof(kDefaultSubcategories) / sizeof(kDefaultSubcategories[0]);
+}
+
+Subcategory Subcategory::Default(size_t position)
+{
+    const DefaultSubcategory &row = kDefaultSubcategories[position];
+    return Subcategory(row.display_name, row.icon_name, row.classification_name);
+}
+
 Subcategory::Subcategory(const std::string &display_name, const std::string &icon_name, const std::string &classification_name) :
         display_name_(display_name), icon_name_(icon_name)
 {
@@ -35,21 +69,34 @@ Subcategory::Subcategory(const std::string &display_name, const std::string &ico
 Subcategory::Subcategory(const std::string &display_name, const std::string &icon_name, const std::vector<std::string> &classification_names) :
         display_name_(display_name), icon_name_(icon_name), classification_names_(classification_names) {}
 
-bool Subcategory::hasEntries() const
+// Orders positions in a pool of desktop entries by the collation keys of the entries
+class CollationKeyLess
 {
-    return !desktopEntries().empty();
-}
+public:
+    explicit CollationKeyLess(const std::vector<std::string> &collation_keys) : collation_keys_(collation_keys) {}
+    bool operator()(size_t left, size_t right) const { return collation_keys_[left] < collation_keys_[right]; }
 
-void Subcategory::addDesktopEntry(const xdg::DesktopEntry &desktop_entry)
+private:
+    const std::vector<std::string> &collation_keys_;
+};
+
+// Tells whether two positions in a pool of desktop entries point to entries with the same collation key
+class CollationKeyEqual
 {
-    desktop_entries_.push_back(desktop_entry);
-}
+public:
+    explicit CollationKeyEqual(const std::vector<std::string> &collation_keys) : collation_keys_(collation_keys) {}
+    bool operator()(size_t left, size_t right) const { return collation_keys_[left] == collation_keys_[right]; }
+
+private:
+    const std::vector<std::string> &collation_keys_;
+};
 
-void Subcategory::sortDesktopEntries()
+// Collation keys are only equal for equal desktop entries, which makes them enough to drop repeated ones
+void Subcategory::sortDesktopEntries(const std::vector<std::string> &collation_keys)
 {
-    std::sort(desktop_entries_.begin(), desktop_entries_.end());
-    std::vector<xdg::DesktopEntry>::iterator it = std::unique(desktop_entries_.begin(), desktop_entries_.end());
-    desktop_entries_.resize(std::distance(desktop_entries_.begin(), it));
+    std::sort(desktop_entry_positions_.begin(), desktop_entry_positions_.end(), CollationKeyLess(collation_keys));
+    std::vector<size_t>::iterator it = std::unique(desktop_entry_positions_.begin(), desktop_entry_positions_.end(), CollationKeyEqual(collation_keys));
+    desktop_entry_positions_.resize(std::distance(desktop_entry_positions_.begin(), it));
 }
 
 } // namespace amm
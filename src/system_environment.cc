@@ -51,6 +51,9 @@ SystemEnvironment::SystemEnvironment()
     if (language_ == "")  {
         language_ = getLanguageWith(std::getenv("LC_ALL"));
     }
+    if (language_ == "")  {
+        language_ = getLanguageWith(std::getenv("LC_MESSAGES"));
+    }
     if (language_ == "") {
         language_ = getLanguageWith(std::getenv("LANG"));
     }
@@ -63,10 +66,34 @@ std::vector<std::string> SystemEnvironment::xdgDataDirectories() const
 
 std::vector<std::string> SystemEnvironment::applicationDirectories() const
 {
-    std::vector<std::string> directories;
-    std::string home_application = StringX(xdgDataHome()).terminateWith("/") + "applications";
-    directories.push_back(home_application);
+    std::vector<std::string> directories(1, homeApplicationDirectory());
+    std::vector<std::string> system_directories = systemApplicationDirectories();
+    directories.insert(directories.end(), system_directories.begin(), system_directories.end());
+    return directories;
+}
+
+std::vector<std::string> SystemEnvironment::iconThemeDirectories() const
+{
+    std::vector<std::string> directories(1, homeIconThemeDirectory());
+    std::vector<std::string> system_directories = systemIconThemeDirectories();
+    directories.insert(directories.end(), system_directories.begin(), system_directories.end());
+    return directories;
+}
+
+std::string SystemEnvironment::homeApplicationDirectory() const
+{
+    return StringX(xdgDataHome()).terminateWith("/") + "applications";
+}
 
+std::string SystemEnvironment::homeIconThemeDirectory() const
+{
+    return StringX(home()).terminateWith("/") + ".icons";
+}
+
+// The directories shared by every user of the system
+std::vector<std::string> SystemEnvironment::systemApplicationDirectories() const
+{
+    std::vector<std::string> directories;
     std::vector<std::string> data_dir_applications = xdgDataDirectories();
     for (std::vector<std::string>::const_iterator directory = data_dir_applications.begin(); directory != data_dir_applications.end(); ++directory) {
         directories.push_back(StringX(*directory).terminateWith("/") + "applications");
@@ -74,12 +101,9 @@ std::vector<std::string> SystemEnvironment::applicationDirectories() const
     return directories;
 }
 
-std::vector<std::string> SystemEnvironment::iconThemeDirectories() const
+std::vector<std::string> SystemEnvironment::systemIconThemeDirectories() const
 {
     std::vector<std::string> directories;
-    std::string home_icon = StringX(home()).terminateWith("/") + ".icons";
-    directories.push_back(home_icon);
-
     std::vector<std::string> xdg_data_dirs = xdgDataDirectories();
     for (std::vector<std::string>::const_iterator directory = xdg_data_dirs.begin(); directory != xdg_data_dirs.end(); ++directory) {
         directories.push_back(StringX(*directory).terminateWith("/") + "icons");
@@ -89,14 +113,30 @@ std::vector<std::string> SystemEnvironment::iconThemeDirectories() const
     return directories;
 }
 
+// The environment another user would have on this system; their XDG_DATA_HOME is assumed to be the default
+SystemEnvironment SystemEnvironment::forHome(const std::string &home) const
+{
+    SystemEnvironment environment = *this;
+    environment.home_ = home;
+    environment.xdg_data_home_ = StringX(home).terminateWith("/") + ".local/share";
+    return environment;
+}
+
 std::string SystemEnvironment::getLanguageWith(const char *raw)
 {
     if (raw == NULL) {
         return "";
     }
 
-    std::string without_encoding = StringX(raw).split(".")[0];
-    return StringX(without_encoding).split("_")[0];
+    // LANGUAGE may hold a colon separated list of preferences
+    std::string locale = raw;
+    locale = locale.substr(0, locale.find(':'));
+
+    size_t encoding_start = locale.find('.');
+    if (encoding_start != std::string::npos) {
+        locale.erase(encoding_start, locale.find('@', encoding_start) - encoding_start);
+    }
+    return locale;
 }
 
 } // namespace amm
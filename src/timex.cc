@@ -44,5 +44,12 @@ std::string currentTimeAsReadble()
     std::strftime(buffer, 80, "%c", timeinfo);
     return buffer;
 }
+
+double monotonicMilliseconds()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+}
 } // namespace timex
 } // namespace amm
@@ -0,0 +1,197 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "timings.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "timex.h"
+#include "allocation_counters.h"
+
+namespace amm {
+
+size_t Timings::findPosition(const std::string &phase) const
+{
+    for (size_t position = 0; position < phases_.size(); ++position) {
+        if (phases_[position] == phase) {
+            return position;
+        }
+    }
+    return phases_.size();
+}
+
+size_t Timings::positionOf(const std::string &phase)
+{
+    size_t position = findPosition(phase);
+    if (position == phases_.size()) {
+        phases_.push_back(phase);
+        milliseconds_.push_back(0);
+        allocations_.push_back(0);
+        allocated_bytes_.push_back(0);
+    }
+    return position;
+}
+
+void Timings::accumulateUntil(double now)
+{
+    const AllocationCounters &counters = AllocationCounters::Process();
+    if (!running_.empty()) {
+        milliseconds_[running_.back()] += now - mark_;
+        allocations_[running_.back()] += counters.allocations - allocations_mark_;
+        allocated_bytes_[running_.back()] += counters.allocated_bytes - allocated_bytes_mark_;
+    }
+    mark_ = now;
+    allocations_mark_ = counters.allocations;
+    allocated_bytes_mark_ = counters.allocated_bytes;
+}
+
+void Timings::start(const std::string &phase)
+{
+    start(phase, "");
+}
+
+// The detail only names the span in a trace, so it is kept only while tracing
+void Timings::start(const std::string &phase, const std::string &detail)
+{
+    size_t position = positionOf(phase);
+    double now = timex::monotonicMilliseconds();
+    accumulateUntil(now);
+    running_.push_back(position);
+    started_at_.push_back(now);
+    details_.push_back(trace_ != NULL ? detail : "");
+}
+
+void Timings::stop()
+{
+    if (running_.empty()) {
+        return;
+    }
+    double now = timex::monotonicMilliseconds();
+    accumulateUntil(now);
+    if (trace_ != NULL) {
+        trace_->addSpan(phases_[running_.back()], details_.back(), started_at_.back(), now);
+    }
+    running_.pop_back();
+    started_at_.pop_back();
+    details_.pop_back();
+}
+
+double Timings::milliseconds(const std::string &phase) const
+{
+    size_t position = findPosition(phase);
+    return position < phases_.size() ? milliseconds_[position] : 0;
+}
+
+size_t Timings::allocations(const std::string &phase) const
+{
+    size_t position = findPosition(phase);
+    return position < phases_.size() ? allocations_[position] : 0;
+}
+
+size_t Timings::allocatedBytes(const std::string &phase) const
+{
+    size_t position = findPosition(phase);
+    return position < phases_.size() ? allocated_bytes_[position] : 0;
+}
+
+double Timings::totalMilliseconds() const
+{
+    double total = 0;
+    for (std::vector<double>::const_iterator milliseconds = milliseconds_.begin(); milliseconds != milliseconds_.end(); ++milliseconds) {
+        total += *milliseconds;
+    }
+    return total;
+}
+
+size_t Timings::totalAllocations() const
+{
+    size_t total = 0;
+    for (std::vector<size_t>::const_iterator allocations = allocations_.begin(); allocations != allocations_.end(); ++allocations) {
+        total += *allocations;
+    }
+    return total;
+}
+
+size_t Timings::totalAllocatedBytes() const
+{
+    size_t total = 0;
+    for (std::vector<size_t>::const_iterator bytes = allocated_bytes_.begin(); bytes != allocated_bytes_.end(); ++bytes) {
+        total += *bytes;
+    }
+    return total;
+}
+
+// The allocation columns only appear in programs that count allocations
+std::string Timings::table() const
+{
+    bool is_counting = AllocationCounters::Process().isCounting();
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << std::left << std::setw(20) << "Phase" << std::right << std::setw(12) << "Time (ms)";
+    if (is_counting) {
+        stream << std::setw(14) << "Allocations" << std::setw(14) << "Bytes";
+    }
+    stream << std::endl;
+    for (size_t position = 0; position < phases_.size(); ++position) {
+        stream << std::left << std::setw(20) << phases_[position] << std::right << std::setw(12) << milliseconds_[position];
+        if (is_counting) {
+            stream << std::setw(14) << allocations_[position] << std::setw(14) << allocated_bytes_[position];
+        }
+        stream << std::endl;
+    }
+    stream << std::left << std::setw(20) << "total" << std::right << std::setw(12) << totalMilliseconds();
+    if (is_counting) {
+        stream << std::setw(14) << totalAllocations() << std::setw(14) << totalAllocatedBytes();
+    }
+    stream << std::endl << "Peak resident memory: " << AllocationCounters::PeakResidentKilobytes() << " kB";
+    if (is_counting) {
+        stream << ", peak heap in use: " << AllocationCounters::Process().peak_live_bytes << " bytes";
+    }
+    return stream.str();
+}
+
+std::string Timings::json() const
+{
+    bool is_counting = AllocationCounters::Process().isCounting();
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"phases\":[";
+    for (size_t position = 0; position < phases_.size(); ++position) {
+        if (position > 0) {
+            stream << ",";
+        }
+        stream << "{\"name\":\"" << phases_[position] << "\",\"milliseconds\":" << milliseconds_[position];
+        if (is_counting) {
+            stream << ",\"allocations\":" << allocations_[position] << ",\"allocated_bytes\":" << allocated_bytes_[position];
+        }
+        stream << "}";
+    }
+    stream << "],\"total_milliseconds\":" << totalMilliseconds();
+    if (is_counting) {
+        stream << ",\"total_allocations\":" << totalAllocations()
+               << ",\"total_allocated_bytes\":" << totalAllocatedBytes()
+               << ",\"peak_heap_bytes\":" << AllocationCounters::Process().peak_live_bytes;
+    }
+    stream << ",\"peak_rss_kilobytes\":" << AllocationCounters::PeakResidentKilobytes() << "}";
+    return stream.str();
+}
+
+} // namespace amm
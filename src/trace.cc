@@ -0,0 +1,72 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "trace.h"
+
+#include <unistd.h>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "stringx.h"
+#include "timex.h"
+
+namespace amm {
+
+Trace::Trace() : process_id_(getpid()), origin_milliseconds_(timex::monotonicMilliseconds())
+{
+}
+
+void Trace::addSpan(const std::string &name, const std::string &detail, double start_milliseconds, double end_milliseconds)
+{
+    Span span;
+    span.name = name;
+    span.detail = detail;
+    span.start_milliseconds = start_milliseconds;
+    span.end_milliseconds = end_milliseconds;
+    spans_.push_back(span);
+}
+
+// Spans are complete ("X") events in microseconds since the trace began
+// Every span runs on the main thread, whose id is the process id
+std::string Trace::json() const
+{
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"traceEvents\":[" << std::endl;
+    for (std::vector<Span>::const_iterator span = spans_.begin(); span != spans_.end(); ++span) {
+        if (span != spans_.begin()) {
+            stream << "," << std::endl;
+        }
+        stream << "{\"name\":" << StringX(span->name).jsonQuoted()
+               << ",\"ph\":\"X\""
+               << ",\"ts\":" << (span->start_milliseconds - origin_milliseconds_) * 1000
+               << ",\"dur\":" << (span->end_milliseconds - span->start_milliseconds) * 1000
+               << ",\"pid\":" << process_id_
+               << ",\"tid\":" << process_id_;
+        if (span->detail != "") {
+            stream << ",\"args\":{\"detail\":" << StringX(span->detail).jsonQuoted() << "}";
+        }
+        stream << "}";
+    }
+    stream << std::endl << "],\"displayTimeUnit\":\"ms\"}" << std::endl;
+    return stream.str();
+}
+
+} // namespace amm
@@ -17,77 +17,110 @@
 */
 
 #include <string>
-#include <sstream>
-#include <vector>
 
 #include "stringx.h"
-#include "vectorx.h"
+#include "xdg/exec.h"
 #include "transformer/jwm.h"
 
 namespace amm {
 namespace transformer {
 
-static std::string removeFieldCode(const std::string &input)
-{
-    std::vector<std::string> result;
-    std::vector<std::string> tokens = StringX(input).split(" ");
-
-    for (std::vector<std::string>::const_iterator iter = tokens.begin(); iter != tokens.end(); ++iter) {
-        if (!(iter->size() >= 1 && (*iter)[0] == '%')) {
-            result.push_back(*iter);
-        }
-    }
-
-    return VectorX(result).join(" ");
-}
+const char Jwm::kMenuIndent[] = "    ";
+const char Jwm::kEntryIndent[] = "        ";
 
 std::string Jwm::transform(const representation::MenuStart &entry) const
 {
-    std::stringstream stream;
-    stream << "<JWM>"
-        << std::endl
-        << "    <!--" << entry.name() << "-->";
-    return stream.str();
+    std::string result;
+    append(entry, &result);
+    return result;
 }
 
 std::string Jwm::transform(const representation::MenuEnd &entry) const
 {
-    std::stringstream stream;
-    stream << "    <!--" << entry.name() << "-->"
-        << std::endl
-        << "</JWM>";
-    return stream.str();
+    std::string result;
+    append(entry, &result);
+    return result;
 }
 
 std::string Jwm::transform(const representation::SubcategoryStart &entry) const
 {
-    std::stringstream stream;
-    stream << "    <Menu "
-        << "label=\"" << StringX(entry.name()).encode()
-        << "\" icon=\"" << entry.icon()
-        << "\">";
-    return stream.str();
+    std::string result;
+    append(entry, &result);
+    return result;
 }
 
 std::string Jwm::transform(const representation::SubcategoryEnd &entry) const
 {
-    std::stringstream stream;
-    stream << "        <!--" << entry.name() << "-->"
-        << std::endl
-        << "    </Menu>";
-    return stream.str();
+    std::string result;
+    append(entry, &result);
+    return result;
 }
 
 std::string Jwm::transform(const representation::Program &entry) const
 {
-    std::stringstream stream;
-    stream << "        <Program "
-        << "label=\"" << StringX(entry.name()).encode()
-        << "\" icon=\"" << StringX(entry.icon()).encode()
-        << "\">"
-        << removeFieldCode(entry.executable())
-        << "</Program>";
-    return stream.str();
+    std::string result;
+    append(entry, &result);
+    return result;
+}
+
+void Jwm::append(const representation::MenuStart &entry, std::string *buffer) const
+{
+    appendMenuStart(entry.name(), buffer);
+}
+
+void Jwm::append(const representation::MenuEnd &entry, std::string *buffer) const
+{
+    appendMenuEnd(entry.name(), buffer);
+}
+
+void Jwm::append(const representation::SubcategoryStart &entry, std::string *buffer) const
+{
+    appendSubcategoryStart(entry.name(), entry.icon(), buffer);
+}
+
+void Jwm::append(const representation::SubcategoryEnd &entry, std::string *buffer) const
+{
+    appendSubcategoryEnd(entry.name(), buffer);
+}
+
+void Jwm::append(const representation::Program &entry, std::string *buffer) const
+{
+    appendProgram(entry.name(), entry.icon(), entry.executable(), buffer);
+}
+
+void Jwm::appendMenuStart(const std::string &name, std::string *buffer)
+{
+    buffer->append("<JWM>\n").append(kMenuIndent).append("<!--").append(name).append("-->");
+}
+
+void Jwm::appendMenuEnd(const std::string &name, std::string *buffer)
+{
+    buffer->append(kMenuIndent).append("<!--").append(name).append("-->\n</JWM>");
+}
+
+void Jwm::appendSubcategoryStart(const std::string &name, const std::string &icon, std::string *buffer)
+{
+    buffer->append(kMenuIndent).append("<Menu label=\"");
+    StringX::appendEncoded(name, buffer);
+    buffer->append("\" icon=\"").append(icon).append("\">");
+}
+
+// The name is the one a SubcategoryEnd representation gives, which marks the end of the subcategory
+void Jwm::appendSubcategoryEnd(const std::string &name, std::string *buffer)
+{
+    buffer->append(kEntryIndent).append("<!--").append(name).append("-->\n");
+    buffer->append(kMenuIndent).append("</Menu>");
+}
+
+void Jwm::appendProgram(const std::string &name, const std::string &icon, const std::string &executable, std::string *buffer)
+{
+    buffer->append(kEntryIndent).append("<Program label=\"");
+    StringX::appendEncoded(name, buffer);
+    buffer->append("\" icon=\"");
+    StringX::appendEncoded(icon, buffer);
+    buffer->append("\">");
+    xdg::Exec::appendWithoutFieldCodes(executable, buffer);
+    buffer->append("</Program>");
 }
 
 } // namespace transformer
@@ -0,0 +1,61 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "transformer/jwm_stream.h"
+
+#include <string>
+
+#include "transformer/jwm.h"
+#include "representation/subcategory_end.h"
+
+namespace amm {
+namespace transformer {
+
+// Every line is laid out by Jwm, and ends with a newline, the last one included
+void JwmStream::menuStart(const std::string &name)
+{
+    Jwm::appendMenuStart(name, output_);
+    output_->push_back('\n');
+}
+
+void JwmStream::menuEnd(const std::string &name)
+{
+    Jwm::appendMenuEnd(name, output_);
+    output_->push_back('\n');
+}
+
+void JwmStream::subcategoryStart(const std::string &name, const std::string &icon)
+{
+    Jwm::appendSubcategoryStart(name, icon, output_);
+    output_->push_back('\n');
+}
+
+void JwmStream::subcategoryEnd(const std::string &name)
+{
+    Jwm::appendSubcategoryEnd(representation::SubcategoryEnd(name).name(), output_);
+    output_->push_back('\n');
+}
+
+void JwmStream::program(const std::string &name, const std::string &icon, const std::string &executable, const std::string &)
+{
+    Jwm::appendProgram(name, icon, executable, output_);
+    output_->push_back('\n');
+}
+
+} // namespace transformer
+} // namespace amm
@@ -24,20 +24,46 @@
 
 #include "stringx.h"
 #include "xdg/entry.h"
+#include "xdg/locale.h"
 
 namespace amm {
 namespace xdg {
 
 void DesktopEntry::parse(const std::vector<std::string> &lines)
 {
-    Entry xdg_entry(lines, language_);
+    Entry xdg_entry(lines);
     xdg_entry.parse();
-    name_ = xdg_entry.under("Desktop Entry", "Name");
-    icon_ = xdg_entry.under("Desktop Entry", "Icon");
-    executable_ = xdg_entry.under("Desktop Entry", "Exec");
-    categories_ = StringX(xdg_entry.under("Desktop Entry", "Categories")).split(";");
-    comment_ = xdg_entry.under("Desktop Entry", "Comment");
-    std::string display_raw = xdg_entry.under("Desktop Entry", "NoDisplay");
+    populate(xdg_entry, 0);
+}
+
+void DesktopEntry::parse(const std::vector<std::string> &lines, const Locale &locale)
+{
+    Entry xdg_entry(lines, locale);
+    xdg_entry.parse();
+    populate(xdg_entry, 0);
+}
+
+// Scans the lines once and returns the entry as seen in each of the locales, in order
+std::vector<DesktopEntry> DesktopEntry::ParsedForEach(const std::vector<std::string> &lines, const std::vector<Locale> &locales)
+{
+    Entry xdg_entry(lines, locales);
+    xdg_entry.parse();
+
+    std::vector<DesktopEntry> entries(locales.size());
+    for (size_t position = 0; position < entries.size(); ++position) {
+        entries[position].populate(xdg_entry, position);
+    }
+    return entries;
+}
+
+void DesktopEntry::populate(Entry &xdg_entry, size_t locale_position)
+{
+    name_ = xdg_entry.under("Desktop Entry", "Name", locale_position);
+    icon_ = xdg_entry.under("Desktop Entry", "Icon", locale_position);
+    executable_ = xdg_entry.under("Desktop Entry", "Exec", locale_position);
+    categories_ = StringX(xdg_entry.under("Desktop Entry", "Categories", locale_position)).split(";");
+    comment_ = xdg_entry.under("Desktop Entry", "Comment", locale_position);
+    std::string display_raw = xdg_entry.under("Desktop Entry", "NoDisplay", locale_position);
     display_ = display_raw != "true" && display_raw != "1";
     std::sort(categories_.begin(), categories_.end());
 }
@@ -62,6 +88,19 @@ bool DesktopEntry::operator != (const DesktopEntry &other) const
     return !(*this == other);
 }
 
+// Orders by the collated name, with the raw name and the executable as tie-breakers,
+// so that only equal entries have equal keys
+std::string DesktopEntry::collationKey() const
+{
+    std::string key = StringX(name_).collationKey();
+    key.reserve(key.size() + name_.size() + executable_.size() + 2);
+    key.push_back('\0');
+    key.append(name_);
+    key.push_back('\0');
+    key.append(executable_);
+    return key;
+}
+
 bool DesktopEntry::isValid() const
 {
     return !executable_.empty() && !name_.empty() && !icon_.empty();
@@ -23,43 +23,91 @@
 #include <map>
 
 #include "xdg/entry_line.h"
+#include "xdg/locale.h"
 
 namespace amm {
 namespace xdg {
 
+Entry::Entry(const std::vector<std::string> &lines, const Locale &locale) : lines_(lines), locales_(1, locale)
+{
+}
+
+Entry::Entry(const std::vector<std::string> &lines, const std::vector<Locale> &locales) : lines_(lines), locales_(locales)
+{
+}
+
+Entry::Entry(const std::vector<std::string> &lines) : lines_(lines), locales_(1, Locale())
+{
+}
+
+// Every locale is ranked against a line while it is scanned, so the lines are
+// read only once however many languages are asked for
 void Entry::parse()
 {
-    std::map< std::string, std::string > entry;
+    size_t locale_count = locales_.size();
+    std::vector< std::map< std::string, std::string > > entries(locale_count);
+    std::vector< std::map< std::string, size_t > > ranks(locale_count);
     std::string current_section = "";
 
+    results_.assign(locale_count, Sections());
+
     for (std::vector<std::string>::iterator iter = lines_.begin(); iter != lines_.end(); ++iter) {
         EntryLine line(*iter);
         if (line.isDeclaration()) {
-            result_[current_section] = entry;
-            entry.clear();
+            for (size_t position = 0; position < locale_count; ++position) {
+                results_[position][current_section] = entries[position];
+                entries[position].clear();
+                ranks[position].clear();
+            }
             current_section = line.declaration();
         } else if (line.isAssignment()) {
-            entry[line.key()] = line.value();
+            std::string key = line.key();
+            size_t locale_start = key.find('[');
+            bool is_localized = locale_start != std::string::npos && key[key.size() - 1] == ']';
+            std::string name = is_localized ? key.substr(0, locale_start) : key;
+            std::string value;
+            bool has_value = false;
+
+            for (size_t position = 0; position < locale_count; ++position) {
+                const Locale &locale = locales_[position];
+                size_t rank = locale.unlocalizedRank();
+
+                if (is_localized) {
+                    rank = locale.rank(key, locale_start + 1, key.size() - locale_start - 2);
+                    if (rank == Locale::kNoMatch) {
+                        continue;
+                    }
+                }
+
+                std::map<std::string, size_t>::iterator best = ranks[position].find(name);
+                if (best != ranks[position].end() && rank > best->second) {
+                    continue;
+                }
+                if (!has_value) {
+                    value = line.value();
+                    has_value = true;
+                }
+                ranks[position][name] = rank;
+                entries[position][name] = value;
+            }
         }
     }
-    result_[current_section] = entry;
+    for (size_t position = 0; position < locale_count; ++position) {
+        results_[position][current_section] = entries[position];
+    }
 }
 
 std::string Entry::under(const std::string &section_name, const std::string &key_name)
 {
-    std::map<std::string, std::string> section = result_[section_name];
-    if (language_ == "") {
-        return section[key_name];
-    }
-
-    std::string language_aware_key_name = key_name + "[" + language_ + "]";
-    std::map<std::string, std::string>::const_iterator language_aware_key_itr = section.find(language_aware_key_name);
+    return under(section_name, key_name, 0);
+}
 
-    if (language_aware_key_itr != section.end()) {
-      return language_aware_key_itr->second;
-    } else {
-      return section[key_name];
+std::string Entry::under(const std::string &section_name, const std::string &key_name, size_t locale_position)
+{
+    if (locale_position >= results_.size()) {
+        return "";
     }
+    return results_[locale_position][section_name][key_name];
 }
 
 } // namespace xdg
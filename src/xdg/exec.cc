@@ -0,0 +1,87 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "xdg/exec.h"
+
+#include <string>
+
+namespace amm {
+namespace xdg {
+
+// Arguments are separated by spaces and are copied with a single space between them.
+// Quoted arguments are copied as they are, backslash escapes included, as field codes have no meaning inside them.
+// Elsewhere "%%" becomes "%" and every other field code is dropped, along with an argument left empty by that.
+void Exec::appendWithoutFieldCodes(const std::string &command_line, std::string *buffer)
+{
+    const size_t start = buffer->size();
+    const size_t size = command_line.size();
+    size_t argument_start = start;
+    bool in_argument = false;
+    bool in_quotes = false;
+    bool has_content = false;
+
+    for (size_t pos = 0; pos < size; ++pos) {
+        char character = command_line[pos];
+
+        if (in_quotes) {
+            buffer->push_back(character);
+            if (character == '\\' && pos + 1 < size) {
+                buffer->push_back(command_line[++pos]);
+            } else if (character == '"') {
+                in_quotes = false;
+            }
+            continue;
+        }
+
+        if (character == ' ') {
+            if (in_argument && !has_content) {
+                buffer->resize(argument_start);
+            }
+            in_argument = false;
+            continue;
+        }
+
+        if (!in_argument) {
+            argument_start = buffer->size();
+            if (argument_start != start) {
+                buffer->push_back(' ');
+            }
+            in_argument = true;
+            has_content = false;
+        }
+
+        if (character == '%' && pos + 1 < size) {
+            if (command_line[++pos] == '%') {
+                buffer->push_back('%');
+                has_content = true;
+            }
+            continue;
+        }
+
+        buffer->push_back(character);
+        has_content = true;
+        in_quotes = character == '"';
+    }
+
+    if (in_argument && !has_content) {
+        buffer->resize(argument_start);
+    }
+}
+
+} // namespace xdg
+} // namespace amm
@@ -0,0 +1,69 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "xdg/locale.h"
+
+#include <string>
+#include <vector>
+
+namespace amm {
+namespace xdg {
+
+const size_t Locale::kNoMatch = static_cast<size_t>(-1);
+
+// Takes a locale of the form lang_COUNTRY.ENCODING@MODIFIER, where everything but lang is optional
+Locale::Locale(const std::string &name)
+{
+    size_t modifier_start = name.find('@');
+    std::string modifier = (modifier_start == std::string::npos) ? "" : name.substr(modifier_start);
+    std::string without_modifier = name.substr(0, modifier_start);
+    std::string without_encoding = without_modifier.substr(0, without_modifier.find('.'));
+
+    size_t country_start = without_encoding.find('_');
+    std::string language = without_encoding.substr(0, country_start);
+    std::string country = (country_start == std::string::npos) ? "" : without_encoding.substr(country_start);
+
+    if (language.empty()) {
+        return;
+    }
+
+    if (!country.empty() && !modifier.empty()) {
+        candidates_.push_back(language + country + modifier);
+    }
+    if (!country.empty()) {
+        candidates_.push_back(language + country);
+    }
+    if (!modifier.empty()) {
+        candidates_.push_back(language + modifier);
+    }
+    candidates_.push_back(language);
+}
+
+// The rank of the locale name found at text[position, position + length); lower ranks are preferred
+size_t Locale::rank(const std::string &text, size_t position, size_t length) const
+{
+    for (size_t index = 0; index < candidates_.size(); ++index) {
+        if (text.compare(position, length, candidates_[index]) == 0) {
+            return index;
+        }
+    }
+    return kNoMatch;
+}
+
+} // namespace xdg
+} // namespace amm
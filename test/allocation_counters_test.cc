@@ -0,0 +1,161 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "allocation_counters.h"
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "filex.h"
+#include "stats.h"
+#include "timings.h"
+#include "transformer/jwm.h"
+#include "xdg/desktop_entry.h"
+#include "xdg/locale.h"
+
+namespace amm {
+
+// Bytes asked for while parsing the VLC fixture, which has a dozen translations
+static size_t desktopEntryParseBytes(const std::vector<std::string> &lines, const xdg::Locale &locale)
+{
+    size_t before = AllocationCounters::Process().allocated_bytes;
+    xdg::DesktopEntry entry;
+    entry.parse(lines, locale);
+    return AllocationCounters::Process().allocated_bytes - before;
+}
+
+// Bytes asked for while laying out a program line, with names and a command line too long to fit in a string
+static size_t programLineBytes()
+{
+    std::string name = "VLC media player & recorder";
+    std::string icon = "/usr/share/icons/hicolor/48x48/apps/vlc.png";
+    std::string executable = "/usr/bin/vlc --started-from-file --no-playlist-enqueue %U";
+    std::string buffer;
+    buffer.reserve(1024);
+    size_t before = AllocationCounters::Process().allocated_bytes;
+    transformer::Jwm::appendProgram(name, icon, executable, &buffer);
+    return AllocationCounters::Process().allocated_bytes - before;
+}
+
+// Bytes asked for while counting a hundred files, a third of them unclassified
+static size_t statsBytes()
+{
+    size_t before = AllocationCounters::Process().allocated_bytes;
+    Stats stats;
+    std::vector<std::string> classifications;
+    classifications.push_back("Calculator");
+    classifications.push_back("Player");
+    for (size_t number = 0; number < 100; ++number) {
+        std::string file_name = "/usr/share/applications/application.desktop";
+        if (number % 3 == 0) {
+            stats.addUnclassifiedFile(file_name);
+            stats.addUnhandledClassifications(classifications);
+        } else {
+            stats.addClassifiedFile(file_name);
+        }
+    }
+    return AllocationCounters::Process().allocated_bytes - before;
+}
+
+SCENARIO("AllocationCounters") {
+    GIVEN("The counters of the test program, which replaces operator new") {
+        AllocationCounters &counters = AllocationCounters::Process();
+
+        THEN("allocations are counted") {
+            CHECK(counters.isCounting());
+        }
+
+        WHEN("a block is allocated and released") {
+            // Checks allocate too, so everything is measured before checking
+            AllocationCounters before = counters;
+            std::vector<char> *block = new std::vector<char>(1000);
+            AllocationCounters allocated = counters;
+            delete block;
+            AllocationCounters released = counters;
+
+            THEN("its allocations and bytes are counted until it is released") {
+                CHECK(allocated.allocations == before.allocations + 2);
+                CHECK(allocated.allocated_bytes == before.allocated_bytes + sizeof(std::vector<char>) + 1000);
+                CHECK(allocated.live_bytes == before.live_bytes + sizeof(std::vector<char>) + 1000);
+                CHECK(allocated.peak_live_bytes >= allocated.live_bytes);
+                CHECK(released.deallocations == before.deallocations + 2);
+                CHECK(released.live_bytes == before.live_bytes);
+            }
+        }
+
+        THEN("the peak resident memory is known") {
+            CHECK(AllocationCounters::PeakResidentKilobytes() > 0);
+        }
+    }
+
+    GIVEN("Timings") {
+        Timings timings;
+
+        WHEN("a phase allocates") {
+            timings.start("parse");
+            std::vector<char> *block = new std::vector<char>(1000);
+            timings.stop();
+            delete block;
+
+            THEN("the allocations are counted for the phase") {
+                CHECK(timings.allocations("parse") >= 2);
+                CHECK(timings.allocatedBytes("parse") >= 1000);
+                CHECK(timings.totalAllocations() == timings.allocations("parse"));
+            }
+
+            THEN("the report shows them") {
+                CHECK(timings.table().find("Allocations") != std::string::npos);
+                CHECK(timings.json().find("\"allocated_bytes\":") != std::string::npos);
+                CHECK(timings.json().find("\"peak_rss_kilobytes\":") != std::string::npos);
+            }
+        }
+    }
+}
+
+// Budgets for the footprint of the classes every desktop file goes through, measured with libstdc++
+// Lower them when a change shrinks the footprint, so that it stays shrunk
+SCENARIO("Allocation budgets") {
+    GIVEN("The VLC desktop file") {
+        std::vector<std::string> lines;
+        REQUIRE(FileX("test/fixtures/applications/vlc.desktop").readLines(&lines));
+
+        WHEN("parsed as a DesktopEntry") {
+            size_t bytes = desktopEntryParseBytes(lines, xdg::Locale("de"));
+            THEN("it stays within its budget") {
+                CHECK(bytes <= 6000);
+            }
+        }
+    }
+
+    GIVEN("A program line appended to a buffer with room for it") {
+        size_t bytes = programLineBytes();
+        THEN("nothing is allocated") {
+            CHECK(bytes == 0);
+        }
+    }
+
+    GIVEN("Counts-only stats for a hundred files") {
+        size_t bytes = statsBytes();
+        THEN("they stay within their budget") {
+            CHECK(bytes <= 6000);
+        }
+    }
+}
+
+} // namespace amm
@@ -46,6 +46,75 @@ SCENARIO("Amm options") {
                 CHECK_FALSE(options.hasValidSummaryType());
             }
         }
+
+        WHEN("timings format is empty, table or json") {
+            THEN("it is valid") {
+                options.timings_format = "";
+                CHECK(options.hasValidTimingsFormat());
+                options.timings_format = "table";
+                CHECK(options.hasValidTimingsFormat());
+                options.timings_format = "json";
+                CHECK(options.hasValidTimingsFormat());
+            }
+        }
+
+        WHEN("timings format is something else") {
+            THEN("it is invalid") {
+                options.timings_format = "xml";
+                CHECK_FALSE(options.hasValidTimingsFormat());
+            }
+        }
+
+        WHEN("report format is empty or json") {
+            THEN("it is valid") {
+                options.report_format = "";
+                CHECK(options.hasValidReportFormat());
+                options.report_format = "json";
+                CHECK(options.hasValidReportFormat());
+            }
+        }
+
+        WHEN("report format is something else") {
+            THEN("it is invalid") {
+                options.report_format = "table";
+                CHECK_FALSE(options.hasValidReportFormat());
+            }
+        }
+
+        WHEN("a single language is given") {
+            options.language = "sr";
+            options.output_file_name = "/tmp/.jwmrc-mjwm";
+
+            THEN("the menu is written to the output file") {
+                CHECK(options.languages() == std::vector<std::string>(1, "sr"));
+                CHECK(options.outputFileNames() == std::vector<std::string>(1, "/tmp/.jwmrc-mjwm"));
+            }
+        }
+
+        WHEN("no language is given") {
+            options.language = "";
+
+            THEN("the default language is the only one") {
+                CHECK(options.languages() == std::vector<std::string>(1, ""));
+            }
+        }
+
+        WHEN("several languages are given") {
+            options.language = "sr:de_DE";
+            options.output_file_name = "/tmp/.jwmrc-mjwm";
+
+            THEN("each menu is written to the output file suffixed with its language") {
+                std::vector<std::string> languages = options.languages();
+                REQUIRE(languages.size() == 2);
+                CHECK(languages[0] == "sr");
+                CHECK(languages[1] == "de_DE");
+
+                std::vector<std::string> output_file_names = options.outputFileNames();
+                REQUIRE(output_file_names.size() == 2);
+                CHECK(output_file_names[0] == "/tmp/.jwmrc-mjwm.sr");
+                CHECK(output_file_names[1] == "/tmp/.jwmrc-mjwm.de_DE");
+            }
+        }
     }
 }
 
@@ -0,0 +1,104 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DO_QUOTE(X)       #X
+#define QUOTE(X)          DO_QUOTE(X)
+
+#include "backup_files.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "filex.h"
+
+namespace amm {
+
+SCENARIO("BackupFiles") {
+    std::string fixture_dir = QUOTE(FIXTUREDIR);
+
+    GIVEN("A file with backups and look-alike files next to it") {
+        std::string file_name = fixture_dir + "backed-up-menu";
+        std::vector<std::string> created;
+        created.push_back(file_name + ".20240105090000.bak");
+        created.push_back(file_name + ".20231231235959.bak");
+        created.push_back(file_name + ".20240101120000.bak");
+        created.push_back(file_name + ".2024.bak");
+        created.push_back(file_name + ".20240101120000.bak.orig");
+        created.push_back(fixture_dir + "other-menu.20240101120000.bak");
+        for (std::vector<std::string>::const_iterator name = created.begin(); name != created.end(); ++name) {
+            remove(name->c_str());
+            FileX(*name).write("backup\n");
+        }
+
+        BackupFiles backup_files(file_name);
+
+        WHEN("listing its backups") {
+            std::vector<std::string> names = backup_files.names();
+
+            THEN("only its timestamped backups are listed, oldest first") {
+                REQUIRE(names.size() == 3);
+                CHECK(names[0] == file_name + ".20231231235959.bak");
+                CHECK(names[1] == file_name + ".20240101120000.bak");
+                CHECK(names[2] == file_name + ".20240105090000.bak");
+            }
+        }
+
+        WHEN("keeping two of them") {
+            size_t removed = backup_files.removeAllBut(2);
+
+            THEN("the oldest one is removed") {
+                CHECK(removed == 1);
+                CHECK_FALSE(FileX(file_name + ".20231231235959.bak").exists());
+                CHECK(FileX(file_name + ".20240101120000.bak").exists());
+                CHECK(FileX(file_name + ".20240105090000.bak").exists());
+            }
+
+            THEN("the look-alike files are left alone") {
+                CHECK(FileX(file_name + ".2024.bak").exists());
+                CHECK(FileX(file_name + ".20240101120000.bak.orig").exists());
+                CHECK(FileX(fixture_dir + "other-menu.20240101120000.bak").exists());
+            }
+        }
+
+        WHEN("keeping more than there are") {
+            size_t removed = backup_files.removeAllBut(5);
+
+            THEN("nothing is removed") {
+                CHECK(removed == 0);
+                CHECK(backup_files.names().size() == 3);
+            }
+        }
+
+        WHEN("keeping none") {
+            size_t removed = backup_files.removeAllBut(0);
+
+            THEN("every backup is removed") {
+                CHECK(removed == 3);
+                CHECK(backup_files.names().empty());
+            }
+        }
+
+        for (std::vector<std::string>::const_iterator name = created.begin(); name != created.end(); ++name) {
+            remove(name->c_str());
+        }
+    }
+}
+
+} // namespace amm
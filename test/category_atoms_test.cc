@@ -0,0 +1,90 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "category_atoms.h"
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "category_set.h"
+
+namespace amm {
+
+SCENARIO("CategoryAtoms") {
+    GIVEN("Category atoms") {
+        CategoryAtoms atoms;
+
+        WHEN("names are interned") {
+            size_t game = atoms.intern("Game");
+            size_t utility = atoms.intern("Utility");
+
+            THEN("each name gets a distinct small integer") {
+                CHECK(game == 0);
+                CHECK(utility == 1);
+                CHECK(atoms.size() == 2);
+            }
+
+            THEN("interning a name again gives the same integer") {
+                CHECK(atoms.intern("Game") == game);
+                CHECK(atoms.size() == 2);
+            }
+
+            THEN("the name can be looked up from the integer") {
+                CHECK(atoms.name(utility) == "Utility");
+            }
+
+            THEN("interned names can be found") {
+                size_t atom = 99;
+                CHECK(atoms.find("Utility", &atom));
+                CHECK(atom == utility);
+            }
+
+            THEN("names never interned can't be found") {
+                size_t atom = 99;
+                CHECK_FALSE(atoms.find("Office", &atom));
+                CHECK(atom == 99);
+            }
+        }
+
+        WHEN("a list of names is interned") {
+            std::vector<std::string> names;
+            names.push_back("AudioVideo");
+            names.push_back("Game");
+            CategorySet interned = atoms.internAll(names);
+
+            THEN("the resulting set contains all of them") {
+                CHECK(interned.contains(0));
+                CHECK(interned.contains(1));
+            }
+
+            THEN("the known subset of another list only has the interned names") {
+                std::vector<std::string> categories;
+                categories.push_back("GTK");
+                categories.push_back("Game");
+                CategorySet known = atoms.knownOf(categories);
+
+                CHECK(known.contains(1));
+                CHECK_FALSE(known.contains(0));
+                CHECK(atoms.size() == 2);
+            }
+        }
+    }
+}
+
+} // namespace amm
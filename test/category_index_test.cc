@@ -0,0 +1,79 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "category_index.h"
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "category_atoms.h"
+
+namespace amm {
+
+SCENARIO("CategoryIndex") {
+    GIVEN("A category index over two subcategories") {
+        CategoryAtoms atoms;
+        CategoryIndex index;
+        index.add(atoms.intern("Game"), 1);
+        index.add(atoms.intern("Fun"), 1);
+        index.add(atoms.intern("Utility"), 0);
+        index.add(atoms.intern("Game"), 0);
+
+        WHEN("looking up categories claimed by both") {
+            std::vector<std::string> categories;
+            categories.push_back("GTK");
+            categories.push_back("Fun");
+            categories.push_back("Game");
+            std::vector<size_t> positions;
+            index.subcategoriesFor(categories, atoms, &positions);
+
+            THEN("each subcategory appears once, in position order") {
+                REQUIRE(positions.size() == 2);
+                CHECK(positions[0] == 0);
+                CHECK(positions[1] == 1);
+            }
+        }
+
+        WHEN("looking up a category claimed by one") {
+            std::vector<std::string> categories;
+            categories.push_back("Utility");
+            std::vector<size_t> positions;
+            positions.push_back(7);
+            index.subcategoriesFor(categories, atoms, &positions);
+
+            THEN("only that subcategory is found") {
+                REQUIRE(positions.size() == 1);
+                CHECK(positions[0] == 0);
+            }
+        }
+
+        WHEN("looking up unknown categories") {
+            std::vector<std::string> categories;
+            categories.push_back("Office");
+            std::vector<size_t> positions;
+            index.subcategoriesFor(categories, atoms, &positions);
+
+            THEN("nothing is found") {
+                CHECK(positions.empty());
+            }
+        }
+    }
+}
+
+} // namespace amm
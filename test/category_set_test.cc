@@ -0,0 +1,79 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "category_set.h"
+
+#include "doctest.h"
+
+namespace amm {
+
+SCENARIO("CategorySet") {
+    GIVEN("A category set") {
+        CategorySet categories;
+
+        WHEN("created") {
+            THEN("it is empty") {
+                CHECK(categories.empty());
+                CHECK_FALSE(categories.contains(0));
+            }
+        }
+
+        WHEN("atoms are inserted") {
+            categories.insert(3);
+            categories.insert(200);
+
+            THEN("it contains them") {
+                CHECK_FALSE(categories.empty());
+                CHECK(categories.contains(3));
+                CHECK(categories.contains(200));
+            }
+
+            THEN("it doesn't contain other atoms") {
+                CHECK_FALSE(categories.contains(4));
+                CHECK_FALSE(categories.contains(1000));
+            }
+        }
+
+        WHEN("compared with a set sharing an atom") {
+            categories.insert(1);
+            categories.insert(130);
+            CategorySet other;
+            other.insert(130);
+
+            THEN("they intersect") {
+                CHECK(categories.intersects(other));
+                CHECK(other.intersects(categories));
+            }
+        }
+
+        WHEN("compared with a set sharing no atoms") {
+            categories.insert(1);
+            categories.insert(130);
+            CategorySet other;
+            other.insert(2);
+            other.insert(300);
+
+            THEN("they don't intersect") {
+                CHECK_FALSE(categories.intersects(other));
+                CHECK_FALSE(other.intersects(categories));
+            }
+        }
+    }
+}
+
+} // namespace amm
@@ -56,10 +56,48 @@ SCENARIO("Command-line arguments default parse") {
                 CHECK_FALSE(options.is_iconize);
             }
 
+            THEN("it keeps every backup") {
+                CHECK_FALSE(options.is_backup_limited);
+            }
+
             THEN("its backup flag is on") {
                 CHECK(options.is_backup);
             }
 
+            THEN("it always reads the inputs") {
+                CHECK_FALSE(options.is_if_changed);
+            }
+
+            THEN("it doesn't report timings") {
+                CHECK(options.timings_format == "");
+            }
+
+            THEN("it doesn't write a trace") {
+                CHECK(options.trace_file_name == "");
+            }
+
+            THEN("it doesn't print a report") {
+                CHECK(options.report_format == "");
+            }
+
+            THEN("it is neither a daemon nor a client") {
+                CHECK_FALSE(options.is_daemon);
+                CHECK_FALSE(options.is_client);
+            }
+
+            THEN("it writes the menu to the output file") {
+                CHECK_FALSE(options.is_dynamic);
+                CHECK(options.dynamic_subcategory_name == "");
+            }
+
+            THEN("its socket is in the home directory") {
+                CHECK(options.socket_name == "/home/mjwm/.mjwm-socket");
+            }
+
+            THEN("it writes a single menu") {
+                CHECK(options.batch_file_name == "");
+            }
+
             THEN("its icon theme is hicolor") {
                 CHECK(options.icon_theme_name == "hicolor");
             }
@@ -164,6 +202,130 @@ SCENARIO("Command-line arguments parse with options") {
             }
         }
 
+        WHEN("parsing --keep-backups [N]") {
+            char* argv[] = {strdup("amm"), strdup("--keep-backups"), strdup("3"), 0};
+            AmmOptions options = parser.parse(3, argv);
+
+            THEN("the parsing succeeds") {
+                CHECK(options.is_parsed);
+            }
+
+            THEN("it keeps the given number of backups") {
+                CHECK(options.is_backup_limited);
+                CHECK(options.backups_to_keep == 3);
+            }
+        }
+
+        WHEN("parsing --keep-backups with something other than a number") {
+            char* argv[] = {strdup("amm"), strdup("--keep-backups=-2"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("the parsing fails") {
+                CHECK_FALSE(options.is_parsed);
+            }
+        }
+
+        WHEN("parsing --if-changed") {
+            char* argv[] = {strdup("amm"), strdup("--if-changed"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("the parsing succeeds") {
+                CHECK(options.is_parsed);
+            }
+
+            THEN("it reads the inputs only when they changed") {
+                CHECK(options.is_if_changed);
+            }
+        }
+
+        WHEN("parsing --timings") {
+            char* argv[] = {strdup("amm"), strdup("--timings"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it reports timings as a table") {
+                CHECK(options.timings_format == "table");
+            }
+        }
+
+        WHEN("parsing --timings=[FORMAT]") {
+            char* argv[] = {strdup("amm"), strdup("--timings=json"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it reports timings in the given format") {
+                CHECK(options.timings_format == "json");
+            }
+        }
+
+        WHEN("parsing --trace=[FILE]") {
+            char* argv[] = {strdup("amm"), strdup("--trace=run.json"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it writes a trace to the given file") {
+                CHECK(options.trace_file_name == "run.json");
+            }
+        }
+
+        WHEN("parsing --report=[FORMAT]") {
+            char* argv[] = {strdup("amm"), strdup("--report=json"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it prints a report in the given format") {
+                CHECK(options.report_format == "json");
+            }
+        }
+
+        WHEN("parsing --daemon") {
+            char* argv[] = {strdup("amm"), strdup("--daemon"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it serves menus on the default socket") {
+                CHECK(options.is_daemon);
+                CHECK_FALSE(options.is_client);
+                CHECK(options.socket_name == "/home/mjwm/.mjwm-socket");
+            }
+        }
+
+        WHEN("parsing --client=[SOCKET]") {
+            char* argv[] = {strdup("amm"), strdup("--client=/run/user/1000/mjwm"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it requests menus on the given socket") {
+                CHECK(options.is_client);
+                CHECK_FALSE(options.is_daemon);
+                CHECK(options.socket_name == "/run/user/1000/mjwm");
+            }
+        }
+
+        WHEN("parsing --batch=[FILE]") {
+            char* argv[] = {strdup("amm"), strdup("--batch=/etc/mjwm/homes"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it reads the home directories from the given file") {
+                CHECK(options.is_parsed);
+                CHECK(options.batch_file_name == "/etc/mjwm/homes");
+            }
+        }
+
+        WHEN("parsing --dynamic") {
+            char* argv[] = {strdup("amm"), strdup("--dynamic"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it prints the whole menu") {
+                CHECK(options.is_dynamic);
+                CHECK(options.dynamic_subcategory_name == "");
+            }
+        }
+
+        WHEN("parsing --dynamic=[SUBCATEGORY]") {
+            char* argv[] = {strdup("amm"), strdup("--dynamic=Multimedia"), 0};
+            AmmOptions options = parser.parse(2, argv);
+
+            THEN("it prints the given subcategory") {
+                CHECK(options.is_dynamic);
+                CHECK(options.dynamic_subcategory_name == "Multimedia");
+            }
+        }
+
         WHEN("parsing --output-file [FILE]") {
             char* argv[] = {strdup("amm"), strdup("--output-file"), strdup("menu.out"), 0};
             AmmOptions options = parser.parse(3, argv);
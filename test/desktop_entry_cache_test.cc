@@ -0,0 +1,76 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "desktop_entry_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "xdg/desktop_entry.h"
+#include "xdg/locale.h"
+
+namespace amm {
+
+static const std::string kapplicationFixturesDirectory = "test/fixtures/applications/";
+
+SCENARIO("DesktopEntryCache") {
+    GIVEN("A cache loaded in two languages") {
+        std::vector<std::string> files;
+        files.push_back(kapplicationFixturesDirectory + "mousepad.desktop");
+        files.push_back(kapplicationFixturesDirectory + "does-not-exist.desktop");
+        std::vector<xdg::Locale> locales;
+        locales.push_back(xdg::Locale("sr"));
+        locales.push_back(xdg::Locale("en"));
+
+        DesktopEntryCache cache;
+        cache.load(files, locales);
+
+        WHEN("a loaded file is looked up") {
+            const std::vector<xdg::DesktopEntry> *entries = cache.find(kapplicationFixturesDirectory + "mousepad.desktop");
+
+            THEN("it has an entry for each language, in order") {
+                bool is_found = entries != NULL;
+                REQUIRE(is_found);
+                REQUIRE(entries->size() == 2);
+                CHECK((*entries)[0].name() == "Мишоловка");
+                CHECK((*entries)[1].name() == "Mousepad");
+            }
+        }
+
+        WHEN("a file that could not be read is looked up") {
+            const std::vector<xdg::DesktopEntry> *entries = cache.find(kapplicationFixturesDirectory + "does-not-exist.desktop");
+
+            THEN("it is known, without entries") {
+                bool is_found = entries != NULL;
+                REQUIRE(is_found);
+                CHECK(entries->empty());
+            }
+        }
+
+        WHEN("a file that was not loaded is looked up") {
+            THEN("it is not found") {
+                bool is_found = cache.find(kapplicationFixturesDirectory + "vlc.desktop") != NULL;
+                CHECK_FALSE(is_found);
+                CHECK(cache.size() == 2);
+            }
+        }
+    }
+}
+
+} // namespace amm
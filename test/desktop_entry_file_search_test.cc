@@ -57,6 +57,13 @@ SCENARIO("DesktopEntryFileSearch custom directories") {
             THEN("it has a list of files with extension 'desktop' inside the directory") {
                 assertFilesArePresentInList(searcher.desktopEntryFileNames());
             }
+
+            THEN("it tracks every directory it scanned") {
+                std::vector<std::string> visited = searcher.visitedDirectoryNames();
+                CHECK(presentIn("test/fixtures/applications/", visited));
+                CHECK(presentIn("test/fixtures/applications/nested", visited));
+                CHECK(presentIn("test/fixtures/applications/nested/deepnested", visited));
+            }
         }
     }
 
@@ -122,6 +129,25 @@ SCENARIO("DesktopEntryFileSearch default directories") {
             }
         }
     }
+
+    GIVEN("Only XDG_DATA_HOME points to an existing directory") {
+        setenv("XDG_DATA_HOME", "test/fixtures", 1);
+        setenv("XDG_DATA_DIRS", "test/does-not-exist", 1);
+
+        GIVEN("A file search service for the system-wide directories") {
+            DesktopEntryFileSearch searcher;
+            searcher.registerSystemDirectories();
+
+            WHEN("resolved") {
+                searcher.resolve();
+
+                THEN("it leaves out the files of the user") {
+                    CHECK(searcher.desktopEntryFileNames().empty());
+                    CHECK(searcher.visitedDirectoryNames().empty());
+                }
+            }
+        }
+    }
 }
 
 } // namespace amm
@@ -21,6 +21,8 @@
 
 #include "filex.h"
 
+#include <sys/stat.h>
+#include <unistd.h>
 #include <cstdlib>
 #include <cstdio>
 #include <string>
@@ -128,6 +130,112 @@ SCENARIO("FileX") {
                 remove(renamed_file_name.c_str());
             }
 
+            THEN("it can write content to the file as is") {
+                std::string file_name = fixture_dir + "new-file";
+
+                remove(file_name.c_str());
+
+                CHECK(FileX(file_name).write("first\nsecond\n"));
+                CHECK_FALSE(FileX(file_name).write("third\n"));
+
+                std::vector<std::string> read_lines;
+                CHECK(FileX(file_name).readLines(&read_lines));
+                REQUIRE(read_lines.size() == 2);
+                CHECK(read_lines[0] == "first");
+                CHECK(read_lines[1] == "second");
+
+                remove(file_name.c_str());
+            }
+
+            THEN("it can read the whole content of the file") {
+                std::string file_name = fixture_dir + "new-file";
+
+                remove(file_name.c_str());
+
+                CHECK(FileX(file_name).write("first\nsecond"));
+
+                std::string content = "stale";
+                CHECK(FileX(file_name).read(&content));
+                CHECK(content == "first\nsecond");
+
+                remove(file_name.c_str());
+            }
+
+            THEN("it can replace the content of the file") {
+                std::string file_name = fixture_dir + "new-file";
+
+                remove(file_name.c_str());
+
+                CHECK(FileX(file_name).replaceWith("first\n"));
+                CHECK(FileX(file_name).replaceWith("second\n"));
+
+                std::string content;
+                CHECK(FileX(file_name).read(&content));
+                CHECK(content == "second\n");
+
+                remove(file_name.c_str());
+            }
+
+            THEN("it replaces the file a symbolic link leads to, keeping the link") {
+                std::string file_name = fixture_dir + "new-file";
+                std::string link_name = fixture_dir + "new-file-link";
+
+                remove(file_name.c_str());
+                remove(link_name.c_str());
+
+                CHECK(FileX(file_name).write("first\n"));
+                CHECK(symlink("new-file", link_name.c_str()) == 0);
+                CHECK(FileX(link_name).replaceWith("second\n"));
+
+                struct stat st;
+                CHECK(lstat(link_name.c_str(), &st) == 0);
+                CHECK(S_ISLNK(st.st_mode));
+                std::string content;
+                CHECK(FileX(file_name).read(&content));
+                CHECK(content == "second\n");
+
+                remove(link_name.c_str());
+                remove(file_name.c_str());
+            }
+
+            THEN("it creates the missing file a symbolic link leads to") {
+                std::string file_name = fixture_dir + "new-file";
+                std::string link_name = fixture_dir + "new-file-link";
+
+                remove(file_name.c_str());
+                remove(link_name.c_str());
+
+                CHECK(symlink("new-file", link_name.c_str()) == 0);
+                CHECK(FileX(link_name).replaceWith("first\n"));
+
+                std::string content;
+                CHECK(FileX(file_name).read(&content));
+                CHECK(content == "first\n");
+
+                remove(link_name.c_str());
+                remove(file_name.c_str());
+            }
+
+            THEN("the replaced file gets the umask's mode when new, and keeps its mode otherwise") {
+                std::string file_name = fixture_dir + "new-file";
+
+                remove(file_name.c_str());
+
+                mode_t mask = umask(022);
+                CHECK(FileX(file_name).replaceWith("first\n"));
+                struct stat st;
+                CHECK(stat(file_name.c_str(), &st) == 0);
+                CHECK((st.st_mode & 07777) == 0644);
+
+                CHECK(chmod(file_name.c_str(), 0600) == 0);
+                CHECK(FileX(file_name).replaceWith("second\n"));
+                CHECK(stat(file_name.c_str(), &st) == 0);
+                CHECK((st.st_mode & 07777) == 0600);
+                umask(mask);
+
+                remove(file_name.c_str());
+            }
+
             THEN("it can delete the file") {
                 std::string file_name = fixture_dir + "new-file";
 
@@ -172,6 +280,11 @@ SCENARIO("FileX") {
                 CHECK_FALSE(filex.existsAsDirectory());
             }
 
+            THEN("it fails to read its whole content") {
+                std::string content;
+                CHECK_FALSE(filex.read(&content));
+            }
+
             THEN("it fails to read its contents") {
                 std::vector<std::string> lines;
                 CHECK_FALSE(filex.readLines(&lines));
@@ -0,0 +1,201 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DO_QUOTE(X)       #X
+#define QUOTE(X)          DO_QUOTE(X)
+
+#include "fingerprint.h"
+
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <clocale>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "filex.h"
+
+namespace amm {
+
+static void touch(const std::string &file_name, long seconds)
+{
+    struct timeval times[2];
+    times[0].tv_sec = seconds;
+    times[0].tv_usec = 0;
+    times[1].tv_sec = seconds;
+    times[1].tv_usec = 0;
+    utimes(file_name.c_str(), times);
+}
+
+SCENARIO("Fingerprint") {
+    std::string fixture_dir = QUOTE(FIXTUREDIR);
+
+    GIVEN("A fingerprint") {
+        Fingerprint fingerprint;
+
+        THEN("its digest is 16 hexadecimal digits") {
+            std::string digest = fingerprint.hex();
+            CHECK(digest.size() == 16);
+            CHECK(digest.find_first_not_of("0123456789abcdef") == std::string::npos);
+        }
+
+        WHEN("the same texts are added to another fingerprint") {
+            Fingerprint other;
+            fingerprint.addText("en");
+            other.addText("en");
+
+            THEN("both have the same digest") {
+                CHECK(fingerprint.hex() == other.hex());
+            }
+        }
+
+        WHEN("the texts are split differently in another fingerprint") {
+            Fingerprint other;
+            fingerprint.addText("ab");
+            fingerprint.addText("c");
+            other.addText("a");
+            other.addText("bc");
+
+            THEN("they have different digests") {
+                CHECK(fingerprint.hex() != other.hex());
+            }
+        }
+    }
+
+    GIVEN("A file") {
+        std::string file_name = fixture_dir + "fingerprinted";
+        remove(file_name.c_str());
+        FileX(file_name).write("content\n");
+        touch(file_name, 1000000000);
+
+        Fingerprint fingerprint;
+        fingerprint.addModificationTime(file_name);
+
+        WHEN("its modification time is added again") {
+            Fingerprint other;
+            other.addModificationTime(file_name);
+
+            THEN("the digest is the same") {
+                CHECK(fingerprint.hex() == other.hex());
+            }
+        }
+
+        WHEN("it is modified") {
+            touch(file_name, 1000000001);
+            Fingerprint other;
+            other.addModificationTime(file_name);
+
+            THEN("the digest changes") {
+                CHECK(fingerprint.hex() != other.hex());
+            }
+        }
+
+        WHEN("it is removed") {
+            remove(file_name.c_str());
+            Fingerprint other;
+            other.addModificationTime(file_name);
+
+            THEN("the digest changes") {
+                CHECK(fingerprint.hex() != other.hex());
+            }
+        }
+
+        remove(file_name.c_str());
+    }
+
+    GIVEN("The collation locale") {
+        std::string collation = setlocale(LC_COLLATE, NULL);
+        bool is_set = setlocale(LC_COLLATE, "C") != NULL;
+        REQUIRE(is_set);
+        Fingerprint fingerprint;
+        fingerprint.addCollation();
+
+        WHEN("it stays the same") {
+            Fingerprint other;
+            other.addCollation();
+
+            THEN("the digest is the same") {
+                CHECK(fingerprint.hex() == other.hex());
+            }
+        }
+
+        WHEN("it changes") {
+            bool is_changed = setlocale(LC_COLLATE, "C.UTF-8") != NULL || setlocale(LC_COLLATE, "C.utf8") != NULL;
+            Fingerprint other;
+            other.addCollation();
+
+            THEN("the digest changes") {
+                REQUIRE(is_changed);
+                CHECK(fingerprint.hex() != other.hex());
+            }
+        }
+
+        setlocale(LC_COLLATE, collation.c_str());
+    }
+
+    GIVEN("An icon theme whose index lists a directory two levels down") {
+        std::string icons_name = fixture_dir + "fingerprinted-icons";
+        std::string theme_name = icons_name + "/hicolor";
+        std::string size_name = theme_name + "/48x48";
+        std::string apps_name = size_name + "/apps";
+        std::string icon_name = apps_name + "/vlc.png";
+        mkdir(icons_name.c_str(), 0755);
+        mkdir(theme_name.c_str(), 0755);
+        mkdir(size_name.c_str(), 0755);
+        mkdir(apps_name.c_str(), 0755);
+        FileX(theme_name + "/index.theme").write("[Icon Theme]\nName=Hicolor\nDirectories=48x48/apps\n\n[48x48/apps]\nSize=48\n");
+        remove(icon_name.c_str());
+        touch(apps_name, 1000000000);
+        touch(size_name, 1000000000);
+        touch(theme_name, 1000000000);
+
+        std::vector<std::string> theme_directories(1, icons_name);
+        Fingerprint fingerprint;
+        fingerprint.addIconThemes(theme_directories);
+
+        WHEN("nothing changes") {
+            Fingerprint other;
+            other.addIconThemes(theme_directories);
+
+            THEN("the digest is the same") {
+                CHECK(fingerprint.hex() == other.hex());
+            }
+        }
+
+        WHEN("an icon is added to the listed directory") {
+            FileX(icon_name).write("png");
+            Fingerprint other;
+            other.addIconThemes(theme_directories);
+
+            THEN("the digest changes") {
+                CHECK(fingerprint.hex() != other.hex());
+            }
+        }
+
+        remove(icon_name.c_str());
+        remove((theme_name + "/index.theme").c_str());
+        rmdir(apps_name.c_str());
+        rmdir(size_name.c_str());
+        rmdir(theme_name.c_str());
+        rmdir(icons_name.c_str());
+    }
+}
+
+} // namespace amm
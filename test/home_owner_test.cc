@@ -0,0 +1,103 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "home_owner.h"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "doctest.h"
+#include "filex.h"
+
+namespace amm {
+
+static const uid_t kNobody = 65534;
+
+SCENARIO("HomeOwner") {
+    GIVEN("A home of another user, whose output file is linked to a file only its owner may read") {
+        bool is_root = geteuid() == 0;
+        char home_template[] = "/tmp/mjwm-home-XXXXXX";
+        std::string home_name = mkdtemp(home_template);
+        char secret_template[] = "/tmp/mjwm-secret-XXXXXX";
+        int secret = mkstemp(secret_template);
+        std::string secret_name = secret_template;
+        REQUIRE(write(secret, "secret", 6) == 6);
+        fchmod(secret, 0600);
+        close(secret);
+
+        std::string output_name = home_name + "/.jwmrc-mjwm";
+        REQUIRE(symlink(secret_name.c_str(), output_name.c_str()) == 0);
+        if (is_root) {
+            REQUIRE(chown(home_name.c_str(), kNobody, kNobody) == 0);
+        }
+
+        WHEN("the output file is replaced as the owner of the home") {
+            bool is_assumed;
+            bool is_read;
+            bool is_replaced;
+            {
+                HomeOwner owner(home_name);
+                is_assumed = owner.isAssumed();
+                std::string content;
+                is_read = FileX(output_name).read(&content);
+                is_replaced = FileX(output_name).replaceWith("menu");
+            }
+
+            THEN("the linked file is neither read nor changed") {
+                CHECK(is_assumed);
+                if (is_root) {
+                    CHECK_FALSE(is_read);
+                    CHECK_FALSE(is_replaced);
+                    std::string secret_content;
+                    CHECK(FileX(secret_name).read(&secret_content));
+                    CHECK(secret_content == "secret");
+                }
+            }
+
+            THEN("the output file is still the link") {
+                struct stat output_stat;
+                REQUIRE(lstat(output_name.c_str(), &output_stat) == 0);
+                CHECK(S_ISLNK(output_stat.st_mode));
+            }
+
+            THEN("the original identity is restored") {
+                CHECK((geteuid() == 0) == is_root);
+            }
+        }
+
+        remove(output_name.c_str());
+        rmdir(home_name.c_str());
+        remove(secret_name.c_str());
+    }
+
+    GIVEN("A home that does not exist") {
+        WHEN("its owner is assumed") {
+            HomeOwner owner("/tmp/mjwm-home-does-not-exist");
+
+            THEN("only root fails to assume it") {
+                CHECK(owner.isAssumed() == (geteuid() != 0));
+            }
+        }
+    }
+}
+
+} // namespace amm
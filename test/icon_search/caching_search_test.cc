@@ -53,6 +53,12 @@ SCENARIO("icon_search::CachingSearch") {
                 CHECK(caching_searcher.isCached("vlc"));
             }
 
+            THEN("the lookup is counted as a resolved cache miss") {
+                CHECK(caching_searcher.lookups() == 1);
+                CHECK(caching_searcher.cacheHits() == 0);
+                CHECK(caching_searcher.resolvedLookups() == 1);
+            }
+
             THEN("the item is same as the original item") {
                 CHECK(caching_searcher.resolvedName("vlc") == "vlc.png");
             }
@@ -64,6 +70,24 @@ SCENARIO("icon_search::CachingSearch") {
                     CHECK(caching_searcher.resolvedName("vlc") == "vlc.png");
                 }
             }
+
+            WHEN("the item is searched again") {
+                caching_searcher.resolvedName("vlc");
+                THEN("the lookup is counted as a cache hit") {
+                    CHECK(caching_searcher.lookups() == 2);
+                    CHECK(caching_searcher.cacheHits() == 1);
+                    CHECK(caching_searcher.resolvedLookups() == 2);
+                }
+            }
+        }
+
+        WHEN("the underlying implementation returns the name it was given") {
+            actual_searcher->extensionIs("");
+            caching_searcher.resolvedName("unknown");
+            THEN("the lookup is not counted as resolved") {
+                CHECK(caching_searcher.lookups() == 1);
+                CHECK(caching_searcher.resolvedLookups() == 0);
+            }
         }
     }
 }
@@ -0,0 +1,67 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "icon_search/layered_search.h"
+
+#include <string>
+#include "../doctest.h"
+#include "icon_search/icon_search_interface.h"
+
+namespace amm {
+namespace icon_search {
+
+class SingleIconSearch : public IconSearchInterface
+{
+public:
+    SingleIconSearch(const std::string &icon_name, const std::string &file_name) : icon_name_(icon_name), file_name_(file_name) { }
+    std::string resolvedName(const std::string &icon_name) const { return icon_name == icon_name_ ? file_name_ : icon_name; }
+private:
+    std::string icon_name_;
+    std::string file_name_;
+};
+
+SCENARIO("icon_search::LayeredSearch") {
+    GIVEN("A search of a home layered over a search of the system") {
+        SingleIconSearch home_searcher("vlc", "/home/mjwm/.icons/vlc.png");
+        SingleIconSearch system_searcher("vlc", "/usr/share/icons/hicolor/48x48/apps/vlc.png");
+        SingleIconSearch other_system_searcher("firefox", "/usr/share/icons/hicolor/48x48/apps/firefox.png");
+        LayeredSearch layered_searcher(home_searcher, system_searcher);
+        LayeredSearch other_layered_searcher(home_searcher, other_system_searcher);
+
+        WHEN("both find an icon") {
+            THEN("the icon of the home is preferred") {
+                CHECK(layered_searcher.resolvedName("vlc") == "/home/mjwm/.icons/vlc.png");
+            }
+        }
+
+        WHEN("only the system finds an icon") {
+            THEN("the icon of the system is used") {
+                CHECK(other_layered_searcher.resolvedName("firefox") == "/usr/share/icons/hicolor/48x48/apps/firefox.png");
+            }
+        }
+
+        WHEN("neither finds an icon") {
+            THEN("the name is kept") {
+                CHECK(layered_searcher.resolvedName("gimp") == "gimp");
+            }
+        }
+    }
+}
+
+} // namespace icon_search
+} // namespace amm
@@ -0,0 +1,63 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "icon_search/timed_search.h"
+
+#include <unistd.h>
+#include <string>
+#include "../doctest.h"
+#include "timings.h"
+#include "icon_search/icon_search_interface.h"
+
+namespace amm {
+namespace icon_search {
+
+class SlowSearch : public IconSearchInterface
+{
+public:
+    std::string resolvedName(const std::string &icon_name) const
+    {
+        usleep(2000);
+        return icon_name + ".png";
+    }
+};
+
+SCENARIO("icon_search::TimedSearch") {
+    GIVEN("An icon search that is timed") {
+        SlowSearch actual_searcher;
+        Timings timings;
+        TimedSearch timed_searcher(actual_searcher, timings);
+
+        WHEN("retrieving an item") {
+            std::string name = timed_searcher.resolvedName("vlc");
+
+            THEN("the item is same as the original item") {
+                CHECK(name == "vlc.png");
+            }
+
+            THEN("the time taken is counted as icon resolution") {
+                REQUIRE(timings.phases().size() == 1);
+                CHECK(timings.phases()[0] == "icon resolution");
+                CHECK(timings.milliseconds("icon resolution") >= 2);
+            }
+        }
+    }
+}
+
+} // namespace icon_search
+} // namespace amm
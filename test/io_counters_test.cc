@@ -0,0 +1,106 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "io_counters.h"
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "filex.h"
+#include "directoryx.h"
+
+namespace amm {
+
+SCENARIO("IoCounters") {
+    GIVEN("The counters of the process, reset") {
+        IoCounters &counters = IoCounters::Process();
+        counters.reset();
+
+        THEN("nothing is counted") {
+            CHECK(counters.stat_calls == 0);
+            CHECK(counters.open_calls == 0);
+            CHECK(counters.opendir_calls == 0);
+            CHECK(counters.readdir_calls == 0);
+            CHECK(counters.bytes_read == 0);
+        }
+
+        WHEN("a file is probed") {
+            FileX("test/fixtures/applications/vlc.desktop").exists();
+            FileX("test/fixtures/applications").existsAsDirectory();
+
+            THEN("every probe is a stat") {
+                CHECK(counters.stat_calls == 2);
+            }
+        }
+
+        WHEN("a file is read") {
+            std::string content;
+            FileX("test/fixtures/applications/vlc.desktop").read(&content);
+
+            THEN("its opening and its bytes are counted") {
+                CHECK(counters.open_calls == 1);
+                CHECK(counters.bytes_read == content.size());
+            }
+        }
+
+        WHEN("a file is read line by line") {
+            std::string content;
+            FileX("test/fixtures/applications/vlc.desktop").read(&content);
+            counters.reset();
+            std::vector<std::string> lines;
+            FileX("test/fixtures/applications/vlc.desktop").readLines(&lines);
+
+            THEN("every byte is counted, line endings included") {
+                CHECK(counters.open_calls == 1);
+                CHECK(counters.bytes_read == content.size());
+            }
+        }
+
+        WHEN("a directory is listed") {
+            DirectoryX directory("test/fixtures/applications/nested/deepnested");
+            directory.isValid();
+            DirectoryX::Entries entries = directory.allEntries();
+            size_t names = 0;
+            for (DirectoryX::Entries::iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+                ++names;
+            }
+
+            THEN("every opening and every entry read is counted, the end of the listing included") {
+                CHECK(counters.opendir_calls == 2);
+                CHECK(counters.readdir_calls == names + 1);
+            }
+        }
+
+        WHEN("the counters are described") {
+            counters.stat_calls = 1;
+            counters.open_calls = 2;
+            counters.opendir_calls = 3;
+            counters.readdir_calls = 4;
+            counters.bytes_read = 5;
+
+            THEN("every counter is shown") {
+                CHECK(counters.details() == "File-system calls: 1 stat, 2 open, 3 opendir, 4 readdir; 5 bytes read");
+            }
+        }
+
+        counters.reset();
+    }
+}
+
+} // namespace amm
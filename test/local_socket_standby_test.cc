@@ -0,0 +1,95 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DO_QUOTE(X)       #X
+#define QUOTE(X)          DO_QUOTE(X)
+
+#include "local_socket_standby.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <string>
+
+#include "doctest.h"
+#include "filex.h"
+#include "local_socket.h"
+
+namespace amm {
+
+class NamingResponder : public LocalSocketResponder
+{
+public:
+    NamingResponder() : answers(0) {}
+    virtual std::string answer(const std::string &request) { ++answers; return "Menu for " + request; }
+    int answers;
+};
+
+SCENARIO("LocalSocketStandby") {
+    std::string socket_name = std::string(QUOTE(FIXTUREDIR)) + "standby.socket";
+
+    GIVEN("A served socket whose process is busy, as while it rebuilds its menu") {
+        LocalSocket server(socket_name);
+        REQUIRE(server.listen());
+        NamingResponder responder;
+
+        WHEN("a client requests while a standby serves the socket") {
+            bool is_serving;
+            bool is_answered;
+            std::string reply;
+            {
+                LocalSocketStandby standby(server, responder);
+                is_serving = standby.isServing();
+                // The process itself never accepts here, as if it were still rebuilding
+                is_answered = LocalSocket(socket_name).request("Multimedia", &reply);
+            }
+
+            THEN("the standby answers the client") {
+                CHECK(is_serving);
+                CHECK(is_answered);
+                CHECK(reply == "Menu for Multimedia");
+            }
+
+            THEN("the answer was given by the forked copy, not the process") {
+                CHECK(responder.answers == 0);
+            }
+
+            THEN("the socket is left for the process to serve once the standby is gone") {
+                CHECK(FileX(socket_name).exists());
+
+                pid_t client_process = fork();
+                REQUIRE(client_process >= 0);
+                if (client_process == 0) {
+                    std::string client_reply;
+                    bool is_client_answered = LocalSocket(socket_name).request("Games", &client_reply);
+                    _exit(is_client_answered && client_reply == "Menu for Games" ? 0 : 1);
+                }
+                bool is_connected = server.waitForConnection(LocalSocket::kTimeoutMilliseconds);
+                bool is_accepted = is_connected && server.answerConnection(responder);
+                int status = 0;
+                waitpid(client_process, &status, 0);
+
+                CHECK(is_accepted);
+                CHECK(responder.answers == 1);
+                CHECK(WIFEXITED(status));
+                CHECK(WEXITSTATUS(status) == 0);
+            }
+        }
+    }
+}
+
+} // namespace amm
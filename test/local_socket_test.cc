@@ -0,0 +1,142 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DO_QUOTE(X)       #X
+#define QUOTE(X)          DO_QUOTE(X)
+
+#include "local_socket.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <string>
+
+#include "doctest.h"
+#include "filex.h"
+
+namespace amm {
+
+SCENARIO("LocalSocket") {
+    std::string socket_name = std::string(QUOTE(FIXTUREDIR)) + "test.socket";
+
+    GIVEN("A socket path that is too long") {
+        LocalSocket socket(std::string(200, 'a'));
+
+        THEN("it is invalid")         { CHECK_FALSE(socket.hasValidPath()); }
+        THEN("it can't be served")    { CHECK_FALSE(socket.listen()); }
+    }
+
+    GIVEN("A socket nobody serves") {
+        remove(socket_name.c_str());
+        LocalSocket socket(socket_name);
+
+        THEN("a request fails") {
+            std::string reply;
+            CHECK_FALSE(socket.request("", &reply));
+        }
+    }
+
+    GIVEN("A served socket") {
+        LocalSocket server(socket_name);
+        REQUIRE(server.listen());
+
+        THEN("it can't be served twice") {
+            LocalSocket other_server(socket_name);
+            CHECK_FALSE(other_server.listen());
+        }
+
+        WHEN("no client connects") {
+            THEN("waiting for a connection times out") {
+                CHECK_FALSE(server.waitForConnection(10));
+            }
+        }
+
+        WHEN("a client connects") {
+            pid_t client_process = fork();
+            REQUIRE(client_process >= 0);
+            if (client_process == 0) {
+                std::string reply;
+                LocalSocket(socket_name).request("", &reply);
+                _exit(0);
+            }
+
+            bool is_connected = server.waitForConnection(LocalSocket::kTimeoutMilliseconds);
+            int status = 0;
+            waitpid(client_process, &status, 0);
+
+            THEN("the connection is noticed without accepting it") {
+                CHECK(is_connected);
+            }
+        }
+
+        WHEN("a client requests while the server answers one connection") {
+            std::string served_reply = "<JWM>" + std::string(100000, 'x') + "</JWM>";
+            pid_t server_process = fork();
+            REQUIRE(server_process >= 0);
+            if (server_process == 0) {
+                int connection = server.accept();
+                std::string message;
+                bool is_written = connection >= 0 && LocalSocket::readAll(connection, &message) &&
+                                  message == "Multimedia" && LocalSocket::writeAll(connection, served_reply);
+                _exit(is_written ? 0 : 1);
+            }
+
+            std::string reply;
+            bool is_answered = LocalSocket(socket_name).request("Multimedia", &reply);
+            int status = 0;
+            waitpid(server_process, &status, 0);
+
+            THEN("the client receives the whole reply") {
+                CHECK(is_answered);
+                CHECK(reply == served_reply);
+            }
+
+            THEN("the server read the whole request and wrote the whole reply") {
+                CHECK(WIFEXITED(status));
+                CHECK(WEXITSTATUS(status) == 0);
+            }
+        }
+    }
+
+    GIVEN("A server that never answers") {
+        LocalSocket server(socket_name);
+        REQUIRE(server.listen());
+
+        WHEN("a client requests") {
+            std::string reply;
+            bool is_answered = LocalSocket(socket_name).request("", &reply);
+
+            THEN("the client gives up") {
+                CHECK_FALSE(is_answered);
+            }
+        }
+    }
+
+    GIVEN("A served socket that is gone") {
+        {
+            LocalSocket server(socket_name);
+            REQUIRE(server.listen());
+        }
+
+        THEN("its file is removed") {
+            CHECK_FALSE(FileX(socket_name).exists());
+        }
+    }
+}
+
+} // namespace amm
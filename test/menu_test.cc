@@ -22,12 +22,15 @@
 #include <vector>
 
 #include "doctest.h"
+#include "io_counters.h"
+#include "desktop_entry_cache.h"
 #include "representation/menu_start.h"
 #include "representation/menu_end.h"
 #include "representation/subcategory_start.h"
 #include "representation/subcategory_end.h"
 #include "representation/program.h"
 #include "transformer/transformer_interface.h"
+#include "transformer/stream_transformer_interface.h"
 #include "icon_search/icon_search_interface.h"
 
 namespace amm {
@@ -63,6 +66,21 @@ public:
     }
 };
 
+class TestStreamTransformer : public transformer::StreamTransformerInterface
+{
+public:
+    std::vector<std::string> events;
+
+    void menuStart(const std::string &name) { events.push_back("Menu start--> name: " + name); }
+    void menuEnd(const std::string &name) { events.push_back("Menu end--> name: " + name); }
+    void subcategoryStart(const std::string &name, const std::string &icon) { events.push_back("Subsection start--> name: " + name + " icon: " + icon); }
+    void subcategoryEnd(const std::string &name) { events.push_back("Subsection end--> name: " + name + " end"); }
+    void program(const std::string &name, const std::string &icon, const std::string &executable, const std::string &comment)
+    {
+        events.push_back("Program--> name: " + name + " icon: " + icon + " executable: " + executable + " comment: " + comment);
+    }
+};
+
 class TestIconSearch : public icon_search::IconSearchInterface
 {
 public:
@@ -188,6 +206,70 @@ SCENARIO("Menu custom categories") {
     }
 }
 
+SCENARIO("Menu default categories") {
+    GIVEN("A menu without custom categories") {
+        Menu menu;
+
+        WHEN("not yet populated") {
+            THEN("it hasn't built any subcategory") {
+                CHECK(menu.subcategories().empty());
+            }
+        }
+
+        WHEN("populated") {
+            std::vector<std::string> files;
+            files.push_back(kapplicationFixturesDirectory + "vlc.desktop");
+            menu.populate(files);
+
+            THEN("it uses the default subcategories followed by the unclassified one") {
+                std::vector<Subcategory> subcategories = menu.subcategories();
+                REQUIRE(subcategories.size() == 12);
+                CHECK(subcategories[0].displayName() == "Settings");
+                CHECK(subcategories[7].displayName() == "Multimedia");
+                CHECK(subcategories[7].hasEntries());
+                CHECK(subcategories[11].displayName() == "Others");
+            }
+
+            WHEN("cleared and populated again") {
+                menu.clear();
+                std::vector<std::string> other_files;
+                other_files.push_back(kapplicationFixturesDirectory + "mousepad.desktop");
+                other_files.push_back(kapplicationFixturesDirectory + "unclassified.desktop");
+                menu.populate(other_files);
+
+                THEN("it only has the files of the second run") {
+                    std::vector<Subcategory> subcategories = menu.subcategories();
+                    REQUIRE(subcategories.size() == 12);
+                    CHECK_FALSE(subcategories[7].hasEntries());
+                    CHECK(subcategories[11].desktopEntryPositions().size() == 1);
+                    CHECK(menu.desktopEntries().size() == 2);
+                    CHECK(menu.summary().totalFiles() == 2);
+                }
+            }
+        }
+    }
+
+    GIVEN("A menu with custom categories") {
+        std::vector<std::string> lines;
+        lines.push_back("Multimedia:multimedia:AudioVideo");
+        Menu menu;
+        menu.loadCustomCategories(lines);
+
+        WHEN("populated") {
+            std::vector<std::string> files;
+            files.push_back(kapplicationFixturesDirectory + "vlc.desktop");
+            menu.populate(files);
+
+            THEN("the default subcategories are never added") {
+                std::vector<Subcategory> subcategories = menu.subcategories();
+                REQUIRE(subcategories.size() == 2);
+                CHECK(subcategories[0].displayName() == "Multimedia");
+                CHECK(subcategories[1].displayName() == "Others");
+            }
+        }
+    }
+}
+
 SCENARIO("Menu statistics") {
     GIVEN("A menu") {
         Menu menu;
@@ -208,6 +290,7 @@ SCENARIO("Menu statistics") {
             std::vector<std::string> files;
             files.push_back(kapplicationFixturesDirectory + "unclassified.desktop");
             files.push_back(kapplicationFixturesDirectory + "mousepad.desktop");
+            menu.retainSummaryDetails();
             menu.populate(files);
             Stats summary = menu.summary();
 
@@ -268,6 +351,63 @@ SCENARIO("Menu statistics") {
     }
 }
 
+SCENARIO("Menu classification types") {
+    GIVEN("Menus classifying linearly and through the category index") {
+        std::vector<std::string> lines;
+        lines.push_back("Multimedia:multimedia:AudioVideo");
+        lines.push_back("Burners:burners:DiscBurning:Archiving");
+        lines.push_back("Utilities:utilities:Utility");
+
+        std::vector<std::string> files;
+        files.push_back(kapplicationFixturesDirectory + "vlc.desktop");
+        files.push_back(kapplicationFixturesDirectory + "nested/xfburn.desktop");
+        files.push_back(kapplicationFixturesDirectory + "mousepad.desktop");
+        files.push_back(kapplicationFixturesDirectory + "unclassified.desktop");
+
+        Menu linear_menu;
+        linear_menu.registerClassificationType(LINEAR_CLASSIFICATION);
+        linear_menu.loadCustomCategories(lines);
+
+        Menu indexed_menu;
+        indexed_menu.registerClassificationType(INDEXED_CLASSIFICATION);
+        indexed_menu.loadCustomCategories(lines);
+
+        WHEN("populated with the same files") {
+            linear_menu.populate(files);
+            indexed_menu.populate(files);
+
+            THEN("both put the same entries in the same subcategories") {
+                std::vector<Subcategory> linear_subcategories = linear_menu.subcategories();
+                std::vector<Subcategory> indexed_subcategories = indexed_menu.subcategories();
+                REQUIRE(linear_subcategories.size() == 4);
+                REQUIRE(indexed_subcategories.size() == 4);
+
+                for (size_t position = 0; position < linear_subcategories.size(); ++position) {
+                    std::vector<xdg::DesktopEntry> linear_entries = linear_menu.desktopEntriesOf(linear_subcategories[position]);
+                    std::vector<xdg::DesktopEntry> indexed_entries = indexed_menu.desktopEntriesOf(indexed_subcategories[position]);
+                    REQUIRE(linear_entries.size() == indexed_entries.size());
+                    for (size_t entry = 0; entry < linear_entries.size(); ++entry) {
+                        CHECK(linear_entries[entry].name() == indexed_entries[entry].name());
+                    }
+                }
+
+                CHECK(indexed_subcategories[0].desktopEntryPositions().size() == 2);
+                CHECK(indexed_subcategories[1].desktopEntryPositions().size() == 1);
+            }
+
+            THEN("both keep a single record of entries listed in several subcategories") {
+                CHECK(linear_menu.desktopEntries().size() == 4);
+                CHECK(indexed_menu.desktopEntries().size() == 4);
+            }
+
+            THEN("both count the same unclassified files") {
+                CHECK(linear_menu.summary().totalUnclassifiedFiles() == 1);
+                CHECK(indexed_menu.summary().totalUnclassifiedFiles() == 1);
+            }
+        }
+    }
+}
+
 SCENARIO("Menu sort") {
     GIVEN("A menu") {
         std::vector<std::string> lines;
@@ -292,20 +432,20 @@ SCENARIO("Menu sort") {
                 REQUIRE(subcategories.size() == 3);
 
                 CHECK(subcategories[0].displayName() == "Multimedia");
-                std::vector<xdg::DesktopEntry> multimedia_files = subcategories[0].desktopEntries();
+                std::vector<xdg::DesktopEntry> multimedia_files = menu.desktopEntriesOf(subcategories[0]);
                 REQUIRE(multimedia_files.size() == 3);
                 CHECK(multimedia_files[0].name() == "VLC media player");
                 CHECK(multimedia_files[1].name() == "Whaaw! Media Player");
                 CHECK(multimedia_files[2].name() == "Xfburn");
 
                 CHECK(subcategories[1].displayName() == "Utilities");
-                std::vector<xdg::DesktopEntry> utility_files = subcategories[1].desktopEntries();
+                std::vector<xdg::DesktopEntry> utility_files = menu.desktopEntriesOf(subcategories[1]);
                 REQUIRE(utility_files.size() == 2);
                 CHECK(utility_files[0].name() == "Mousepad");
                 CHECK(utility_files[1].name() == "Xfburn");
 
                 CHECK(subcategories[2].displayName() == "Others");
-                std::vector<xdg::DesktopEntry> other_files = subcategories[2].desktopEntries();
+                std::vector<xdg::DesktopEntry> other_files = menu.desktopEntriesOf(subcategories[2]);
                 CHECK(other_files.empty());
             }
         }
@@ -395,4 +535,122 @@ SCENARIO("Menu representations") {
     }
 }
 
+SCENARIO("Menus for several languages") {
+    GIVEN("Menus in different languages") {
+        Menu serbian_menu;
+        serbian_menu.registerLanguage("sr");
+        Menu english_menu;
+        english_menu.registerLanguage("en");
+        std::vector<Menu*> menus;
+        menus.push_back(&serbian_menu);
+        menus.push_back(&english_menu);
+
+        WHEN("populated together") {
+            std::vector<std::string> files;
+            files.push_back(kapplicationFixturesDirectory + "vlc.desktop");
+            files.push_back(kapplicationFixturesDirectory + "mousepad.desktop");
+            files.push_back(kapplicationFixturesDirectory + "missing.desktop");
+            Menu::PopulateAll(menus, files);
+
+            THEN("each menu uses names in its own language") {
+                REQUIRE(serbian_menu.desktopEntries().size() == 2);
+                REQUIRE(english_menu.desktopEntries().size() == 2);
+                CHECK(serbian_menu.desktopEntries()[1].name() == "Мишоловка");
+                CHECK(english_menu.desktopEntries()[1].name() == "Mousepad");
+            }
+
+            THEN("each menu has the same subcategories") {
+                CHECK(serbian_menu.subcategories().size() == english_menu.subcategories().size());
+            }
+
+            THEN("each menu records the files it could not parse") {
+                CHECK(serbian_menu.summary().totalParsedFiles() == 2);
+                CHECK(serbian_menu.summary().totalUnparsedFiles() == 1);
+                CHECK(english_menu.summary().totalUnparsedFiles() == 1);
+            }
+        }
+
+        WHEN("populated with shared entries loaded in the same languages") {
+            std::vector<std::string> shared_files;
+            shared_files.push_back(kapplicationFixturesDirectory + "vlc.desktop");
+            shared_files.push_back(kapplicationFixturesDirectory + "missing.desktop");
+            std::vector<xdg::Locale> locales;
+            locales.push_back(xdg::Locale("sr"));
+            locales.push_back(xdg::Locale("en"));
+            DesktopEntryCache shared_entries;
+            shared_entries.load(shared_files, locales);
+
+            std::vector<std::string> files;
+            files.push_back(kapplicationFixturesDirectory + "mousepad.desktop");
+            files.insert(files.end(), shared_files.begin(), shared_files.end());
+
+            size_t open_calls = IoCounters::Process().open_calls;
+            Menu::PopulateAll(menus, files, shared_entries);
+
+            THEN("only the files outside the shared entries are read") {
+                CHECK(IoCounters::Process().open_calls == open_calls + 1);
+            }
+
+            THEN("each menu has both its own and the shared entries") {
+                REQUIRE(serbian_menu.desktopEntries().size() == 2);
+                CHECK(serbian_menu.desktopEntries()[0].name() == "Мишоловка");
+                CHECK(english_menu.desktopEntries()[0].name() == "Mousepad");
+                CHECK(serbian_menu.summary().totalUnparsedFiles() == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("Menu streaming") {
+    GIVEN("A populated menu") {
+        std::vector<std::string> files;
+        files.push_back(kapplicationFixturesDirectory + "vlc.desktop");
+        files.push_back(kapplicationFixturesDirectory + "mousepad.desktop");
+
+        Menu menu;
+        menu.populate(files);
+        menu.sort();
+
+        WHEN("streamed to a transformer") {
+            TestStreamTransformer stream_transformer;
+            menu.stream(stream_transformer);
+
+            THEN("the transformer receives the same sequence as the representations") {
+                std::vector<representation::RepresentationInterface*> representations = menu.representations();
+                TestTransformer test_transformer;
+
+                REQUIRE(stream_transformer.events.size() == representations.size());
+                for (size_t position = 0; position < representations.size(); ++position) {
+                    CHECK(stream_transformer.events[position] == representations[position]->visit(test_transformer));
+                }
+
+                clearMemory(representations);
+            }
+        }
+
+        WHEN("a subcategory is streamed to a transformer") {
+            TestStreamTransformer stream_transformer;
+            menu.stream(stream_transformer, "Multimedia");
+
+            THEN("the transformer receives only its programs, as a whole menu") {
+                REQUIRE(stream_transformer.events.size() == 3);
+                CHECK(stream_transformer.events[0] == "Menu start--> name: Menu start");
+                CHECK(stream_transformer.events[1].find("Program--> name: VLC media player") == 0);
+                CHECK(stream_transformer.events[2] == "Menu end--> name: Menu end");
+            }
+        }
+
+        WHEN("an unknown subcategory is streamed to a transformer") {
+            TestStreamTransformer stream_transformer;
+            menu.stream(stream_transformer, "Unknown");
+
+            THEN("the transformer receives an empty menu") {
+                REQUIRE(stream_transformer.events.size() == 2);
+                CHECK(stream_transformer.events[0] == "Menu start--> name: Menu start");
+                CHECK(stream_transformer.events[1] == "Menu end--> name: Menu end");
+            }
+        }
+    }
+}
+
 } // namespace amm
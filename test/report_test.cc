@@ -0,0 +1,115 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "report.h"
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "stats.h"
+#include "timings.h"
+
+namespace amm {
+
+static bool contains(const std::string &text, const std::string &part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+SCENARIO("Report") {
+    GIVEN("A report of an empty run") {
+        Stats stats;
+        Timings timings;
+        Report report("mjwm 4.1.0", stats, timings);
+
+        WHEN("written as JSON") {
+            std::string json = report.json();
+
+            THEN("it is one object starting with the version") {
+                CHECK(json.find("{\"version\":\"mjwm 4.1.0\",") == 0);
+                CHECK(json[json.size() - 1] == '}');
+            }
+
+            THEN("every total is zero") {
+                CHECK(contains(json, "\"totals\":{\"files\":0,\"parsed\":0,\"unparsed\":0,\"suppressed\":0,\"unclassified\":0}"));
+            }
+
+            THEN("the lists are empty") {
+                CHECK(contains(json, "\"categories\":[]"));
+                CHECK(contains(json, "\"unparsed_files\":[]"));
+                CHECK(contains(json, "\"unhandled_classifications\":[]"));
+            }
+
+            THEN("the icon rates are zero rather than undefined") {
+                CHECK(contains(json, "\"cache_hit_rate\":0.000,\"resolved_rate\":0.000"));
+            }
+
+            THEN("it ends with the timings") {
+                CHECK(contains(json, "\"timings\":{\"phases\":[]"));
+            }
+        }
+    }
+
+    GIVEN("A report of a run") {
+        Stats stats;
+        stats.retainDetails();
+        stats.addClassifiedFile("vlc.desktop");
+        stats.addUnclassifiedFile("htop.desktop");
+        stats.addUnparsedFile("\"daemon\".desktop");
+        stats.addSuppressedFile("mplayer.desktop");
+        std::vector<std::string> classifications;
+        classifications.push_back("Monitor");
+        stats.addUnhandledClassifications(classifications);
+        Timings timings;
+        Report report("mjwm 4.1.0", stats, timings);
+        report.registerOutput("/home/user/.jwmrc-mjwm", "created", "", 2);
+        report.registerIconLookups(4, 1, 3);
+        report.addCategory("Multimedia", 1);
+        report.addCategory("Others", 1);
+
+        WHEN("written as JSON") {
+            std::string json = report.json();
+
+            THEN("it has the output file and its status") {
+                CHECK(contains(json, "\"output\":{\"file\":\"/home/user/.jwmrc-mjwm\",\"status\":\"created\",\"backup_file\":\"\",\"removed_backups\":2}"));
+            }
+
+            THEN("it has the totals") {
+                CHECK(contains(json, "\"totals\":{\"files\":4,\"parsed\":2,\"unparsed\":1,\"suppressed\":1,\"unclassified\":1}"));
+            }
+
+            THEN("it has the entries in each category") {
+                CHECK(contains(json, "\"categories\":[{\"name\":\"Multimedia\",\"entries\":1},{\"name\":\"Others\",\"entries\":1}]"));
+            }
+
+            THEN("it lists the skipped files and unhandled classifications, escaped") {
+                CHECK(contains(json, "\"unparsed_files\":[\"\\\"daemon\\\".desktop\"]"));
+                CHECK(contains(json, "\"suppressed_files\":[\"mplayer.desktop\"]"));
+                CHECK(contains(json, "\"unclassified_files\":[\"htop.desktop\"]"));
+                CHECK(contains(json, "\"unhandled_classifications\":[\"Monitor\"]"));
+            }
+
+            THEN("it has the icon lookups and their rates") {
+                CHECK(contains(json, "\"icons\":{\"lookups\":4,\"cache_hits\":1,\"resolved\":3,\"cache_hit_rate\":0.250,\"resolved_rate\":0.750}"));
+            }
+        }
+    }
+}
+
+} // namespace amm
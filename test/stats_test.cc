@@ -27,6 +27,7 @@ namespace amm {
 
 static Stats populatedStats() {
     Stats stats;
+    stats.retainDetails();
     stats.addClassifiedFile("VLC");
     stats.addClassifiedFile("Mousepad");
     stats.addClassifiedFile("Firefox");
@@ -157,6 +158,44 @@ SCENARIO("Stats summaries") {
                                                 "\nUnhandled classifications: Archiving, Browser, Calculator, Player, WordProcessor";
                 CHECK(stats.details("long") == expected_details);
             }
+
+            THEN("the unhandled classifications are sorted and unique") {
+                std::vector<std::string> unhandled_classifications = stats.unhandledClassifications();
+
+                REQUIRE(unhandled_classifications.size() == 5);
+                CHECK(unhandled_classifications[0] == "Archiving");
+                CHECK(unhandled_classifications[4] == "WordProcessor");
+            }
+        }
+    }
+
+    GIVEN("A stat keeping only counts") {
+        Stats stats;
+        stats.addClassifiedFile("VLC");
+        stats.addClassifiedFile("Mousepad");
+        stats.addClassifiedFile("Firefox");
+        stats.addUnclassifiedFile("htop");
+        stats.addUnclassifiedFile("NEdit");
+        stats.addUnparsedFile("daemon");
+        stats.addSuppressedFile("mplayer");
+        stats.addUnhandledClassifications(unhandledClassificationFirstSet());
+
+        WHEN("different types of files are added") {
+            THEN("it has the same counts") {
+                CHECK(stats.totalFiles() == 7);
+                CHECK(stats.totalUnclassifiedFiles() == 2);
+                CHECK(stats.totalSuppressedFiles() == 1);
+            }
+
+            THEN("it keeps no lists of suppressed and unclassified files") {
+                CHECK(stats.suppressedFiles().empty());
+                CHECK(stats.unclassifiedFiles().empty());
+                CHECK(stats.unhandledClassifications().empty());
+            }
+
+            THEN("long details are the normal details") {
+                CHECK(stats.details("long") == expectedNormalDetails());
+            }
         }
     }
 }
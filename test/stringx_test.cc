@@ -113,6 +113,67 @@ SCENARIO("StringX") {
         }
     }
 
+    GIVEN("A long stringx with XML tags around 16 byte boundaries") {
+        StringX stringx("/usr/share/icons/<hicolor>/48x48/apps/a&b's \"icon\".png&");
+
+        WHEN("XML encoded") {
+            std::string result = stringx.encode();
+            THEN("every XML tag is replaced, wherever it falls") {
+                CHECK(result == "/usr/share/icons/&lt;hicolor&gt;/48x48/apps/a&amp;b&apos;s &quot;icon&quot;.png&amp;");
+            }
+        }
+    }
+
+    GIVEN("A long stringx without XML tags") {
+        StringX stringx("/usr/share/icons/hicolor/48x48/apps/accessories-text-editor.png");
+
+        WHEN("XML encoded") {
+            std::string result = stringx.encode();
+            THEN("it is unchanged") {
+                CHECK(result == "/usr/share/icons/hicolor/48x48/apps/accessories-text-editor.png");
+            }
+        }
+
+        WHEN("XML encoded at the end of a buffer") {
+            std::string buffer = "icon=";
+            stringx.appendEncodedTo(&buffer);
+            THEN("the buffer keeps its content and ends with the string") {
+                CHECK(buffer == "icon=/usr/share/icons/hicolor/48x48/apps/accessories-text-editor.png");
+            }
+        }
+
+        WHEN("XML encoded in place, without a stringx") {
+            std::string buffer = "label=";
+            StringX::appendEncoded("Fun & <Games>", &buffer);
+            THEN("the buffer ends with the encoded string") {
+                CHECK(buffer == "label=Fun &amp; &lt;Games&gt;");
+            }
+        }
+    }
+
+    GIVEN("A stringx with quotes, backslashes and control characters") {
+        StringX stringx("say \"hi\"\\\n\tnow");
+
+        WHEN("quoted as JSON") {
+            std::string result = stringx.jsonQuoted();
+            THEN("it is surrounded by quotes with the special characters escaped") {
+                CHECK(result == "\"say \\\"hi\\\"\\\\\\u000a\\u0009now\"");
+            }
+        }
+    }
+
+    GIVEN("Strings differing in case") {
+        StringX lower("htop");
+        StringX upper("Mousepad");
+
+        WHEN("collated in the default locale") {
+            THEN("their keys order them alphabetically regardless of case") {
+                CHECK(lower.collationKey() < upper.collationKey());
+                CHECK(StringX("Htop").collationKey() == lower.collationKey());
+            }
+        }
+    }
+
     GIVEN("A stringx with whitespaces at extremes") {
         StringX stringx(" \taccessories-text-editor \t\n");
 
@@ -23,6 +23,8 @@
 
 #include "doctest.h"
 #include "xdg/desktop_entry.h"
+#include "category_atoms.h"
+#include "category_set.h"
 
 namespace amm {
 
@@ -50,6 +52,18 @@ static xdg::DesktopEntry sakuraDesktopEntry() {
     return entry;
 }
 
+static xdg::DesktopEntry htopDesktopEntry() {
+    std::vector<std::string> lines;
+    lines.push_back("[Desktop Entry]");
+    lines.push_back("Name=htop");
+    lines.push_back("Icon=htop");
+    lines.push_back("Exec=htop");
+    lines.push_back("Categories=ConsoleOnly;System;Monitor;");
+    xdg::DesktopEntry entry;
+    entry.parse(lines);
+    return entry;
+}
+
 SCENARIO("subcategory") {
     GIVEN("A subcategory") {
         Subcategory subcategory("Accessories", "accessories", "Utilities");
@@ -60,42 +74,109 @@ SCENARIO("subcategory") {
             }
         }
 
+        std::vector<xdg::DesktopEntry> desktop_entries;
+        desktop_entries.push_back(sakuraDesktopEntry());
+        desktop_entries.push_back(mousepadDesktopEntry());
+        desktop_entries.push_back(sakuraDesktopEntry());
+        desktop_entries.push_back(htopDesktopEntry());
+
+        std::vector<std::string> collation_keys;
+        for (std::vector<xdg::DesktopEntry>::const_iterator entry = desktop_entries.begin(); entry != desktop_entries.end(); ++entry) {
+            collation_keys.push_back(entry->collationKey());
+        }
+
         WHEN("with one desktop-file") {
-            subcategory.addDesktopEntry(mousepadDesktopEntry());
+            subcategory.addDesktopEntry(1);
             THEN("it has entries") {
                 CHECK(subcategory.hasEntries());
             }
         }
 
         WHEN("with two desktop-file") {
-            subcategory.addDesktopEntry(sakuraDesktopEntry());
-            subcategory.addDesktopEntry(mousepadDesktopEntry());
+            subcategory.addDesktopEntry(0);
+            subcategory.addDesktopEntry(1);
             WHEN("sorted") {
-                subcategory.sortDesktopEntries();
+                subcategory.sortDesktopEntries(collation_keys);
                 THEN("its entries are alphabetically sorted by name") {
-                    std::vector<xdg::DesktopEntry> desktop_entries = subcategory.desktopEntries();
-                    REQUIRE(desktop_entries.size() == 2);
-                    CHECK(desktop_entries[0].name() == "Mousepad");
-                    CHECK(desktop_entries[1].name() == "Sakura");
+                    std::vector<size_t> positions = subcategory.desktopEntryPositions();
+                    REQUIRE(positions.size() == 2);
+                    CHECK(desktop_entries[positions[0]].name() == "Mousepad");
+                    CHECK(desktop_entries[positions[1]].name() == "Sakura");
+                }
+            }
+        }
+
+        WHEN("with desktop files whose names start in different cases") {
+            subcategory.addDesktopEntry(0);
+            subcategory.addDesktopEntry(3);
+            subcategory.addDesktopEntry(1);
+            WHEN("sorted") {
+                subcategory.sortDesktopEntries(collation_keys);
+                THEN("its entries are sorted alphabetically rather than by byte value") {
+                    std::vector<size_t> positions = subcategory.desktopEntryPositions();
+                    REQUIRE(positions.size() == 3);
+                    CHECK(desktop_entries[positions[0]].name() == "htop");
+                    CHECK(desktop_entries[positions[1]].name() == "Mousepad");
+                    CHECK(desktop_entries[positions[2]].name() == "Sakura");
                 }
             }
         }
 
+        WHEN("its classification names are interned") {
+            CategoryAtoms atoms;
+            atoms.intern("Game");
+            subcategory.internClassificationNames(atoms);
+
+            THEN("it classifies categories including its classification names") {
+                std::vector<std::string> categories;
+                categories.push_back("Utilities");
+                categories.push_back("GTK");
+                CHECK(subcategory.classifies(atoms.knownOf(categories)));
+            }
+
+            THEN("it doesn't classify categories without its classification names") {
+                std::vector<std::string> categories;
+                categories.push_back("Game");
+                categories.push_back("GTK");
+                CHECK_FALSE(subcategory.classifies(atoms.knownOf(categories)));
+            }
+        }
+
         WHEN("with a repeated desktop file") {
-            subcategory.addDesktopEntry(sakuraDesktopEntry());
-            subcategory.addDesktopEntry(mousepadDesktopEntry());
-            subcategory.addDesktopEntry(sakuraDesktopEntry());
+            subcategory.addDesktopEntry(0);
+            subcategory.addDesktopEntry(1);
+            subcategory.addDesktopEntry(2);
             WHEN("sorted") {
-                subcategory.sortDesktopEntries();
+                subcategory.sortDesktopEntries(collation_keys);
                 THEN("it doesn't repeat entries") {
-                    std::vector<xdg::DesktopEntry> desktop_entries = subcategory.desktopEntries();
-                    REQUIRE(desktop_entries.size() == 2);
-                    CHECK(desktop_entries[0].name() == "Mousepad");
-                    CHECK(desktop_entries[1].name() == "Sakura");
+                    std::vector<size_t> positions = subcategory.desktopEntryPositions();
+                    REQUIRE(positions.size() == 2);
+                    CHECK(desktop_entries[positions[0]].name() == "Mousepad");
+                    CHECK(desktop_entries[positions[1]].name() == "Sakura");
                 }
             }
         }
     }
 }
 
+SCENARIO("default subcategories") {
+    GIVEN("The built-in layout") {
+        WHEN("materialized") {
+            THEN("it has the eleven standard subcategories in menu order") {
+                REQUIRE(Subcategory::DefaultCount() == 11);
+                CHECK(Subcategory::Default(0).displayName() == "Settings");
+                CHECK(Subcategory::Default(10).displayName() == "System");
+            }
+
+            THEN("each has its icon and a single classification name") {
+                Subcategory multimedia = Subcategory::Default(7);
+                CHECK(multimedia.displayName() == "Multimedia");
+                CHECK(multimedia.iconName() == "applications-multimedia");
+                REQUIRE(multimedia.classificationNames().size() == 1);
+                CHECK(multimedia.classificationNames()[0] == "AudioVideo");
+            }
+        }
+    }
+}
+
 } // namespace amm
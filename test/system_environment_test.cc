@@ -109,14 +109,57 @@ SCENARIO("SystemEnvironment") {
                     CHECK(directories[3] == "/usr/share/pixmaps");
                 }
             }
+
+            WHEN("the system-wide directories are asked") {
+                THEN("the directories under $HOME are left out") {
+                    std::vector<std::string> applications = environment.systemApplicationDirectories();
+                    REQUIRE(applications.size() == 2);
+                    CHECK(applications[0] == "/usr/local/share/applications");
+                    CHECK(applications[1] == "/usr/share/applications");
+
+                    std::vector<std::string> icons = environment.systemIconThemeDirectories();
+                    REQUIRE(icons.size() == 3);
+                    CHECK(icons[0] == "/usr/local/share/icons");
+                    CHECK(icons[2] == "/usr/share/pixmaps");
+                }
+            }
+
+            WHEN("the environment of another home is asked") {
+                SystemEnvironment other = environment.forHome("/home/other");
+
+                THEN("its directories are under the other home") {
+                    CHECK(other.home() == "/home/other");
+                    CHECK(other.homeApplicationDirectory() == "/home/other/.local/share/applications");
+                    CHECK(other.homeIconThemeDirectory() == "/home/other/.icons");
+                    CHECK(other.systemApplicationDirectories() == environment.systemApplicationDirectories());
+                }
+            }
         }
     }
 
     GIVEN("LANGUAGE is set with encoding and sub-type") {
         WHEN("langauage is asked") {
-            THEN("it is the first part of the LANGUAGE") {
+            THEN("it is the LANGUAGE without the encoding") {
                 setenv("LANGUAGE", "en_IN.UTF-8", 1);
-                CHECK(SystemEnvironment().language() == "en");
+                CHECK(SystemEnvironment().language() == "en_IN");
+            }
+        }
+    }
+
+    GIVEN("LANGUAGE is set with encoding and modifier") {
+        WHEN("langauage is asked") {
+            THEN("it keeps the modifier") {
+                setenv("LANGUAGE", "sr_RS.UTF-8@latin", 1);
+                CHECK(SystemEnvironment().language() == "sr_RS@latin");
+            }
+        }
+    }
+
+    GIVEN("LANGUAGE is set to a list of languages") {
+        WHEN("langauage is asked") {
+            THEN("it is the first language in the list") {
+                setenv("LANGUAGE", "sr_RS:en_IN", 1);
+                CHECK(SystemEnvironment().language() == "sr_RS");
             }
         }
     }
@@ -126,8 +169,9 @@ SCENARIO("SystemEnvironment") {
             THEN("it is the first part of the LANGUAGE") {
                 setenv("LANGUAGE", "en_IN.UTF-8", 1);
                 unsetenv("LC_ALL");
+                unsetenv("LC_MESSAGES");
                 unsetenv("LANG");
-                CHECK(SystemEnvironment().language() == "en");
+                CHECK(SystemEnvironment().language() == "en_IN");
             }
         }
     }
@@ -143,30 +187,44 @@ SCENARIO("SystemEnvironment") {
 
     GIVEN("LANGUAGE is not set but LC_ALL is set") {
         WHEN("langauage is asked") {
-            THEN("it is the first part of the LC_ALL") {
+            THEN("it is the LC_ALL without the encoding") {
                 unsetenv("LANGUAGE");
                 setenv("LC_ALL", "en_IN.UTF-8", 1);
-                CHECK(SystemEnvironment().language() == "en");
+                CHECK(SystemEnvironment().language() == "en_IN");
             }
         }
     }
 
-    GIVEN("LANGUAGE and LC_ALL are not set but LANG is set") {
+    GIVEN("LANGUAGE and LC_ALL are not set but LC_MESSAGES is set") {
         WHEN("langauage is asked") {
-            THEN("it is the first part of the LANG") {
+            THEN("it is the LC_MESSAGES without the encoding") {
                 unsetenv("LANGUAGE");
                 unsetenv("LC_ALL");
+                setenv("LC_MESSAGES", "bn_IN.UTF-8", 1);
                 setenv("LANG", "en_IN.UTF-8", 1);
-                CHECK(SystemEnvironment().language() == "en");
+                CHECK(SystemEnvironment().language() == "bn_IN");
+            }
+        }
+    }
+
+    GIVEN("LANGUAGE, LC_ALL and LC_MESSAGES are not set but LANG is set") {
+        WHEN("langauage is asked") {
+            THEN("it is the LANG without the encoding") {
+                unsetenv("LANGUAGE");
+                unsetenv("LC_ALL");
+                unsetenv("LC_MESSAGES");
+                setenv("LANG", "en_IN.UTF-8", 1);
+                CHECK(SystemEnvironment().language() == "en_IN");
             }
         }
     }
 
-    GIVEN("LANGUAGE, LC_ALL and LANG are not set") {
+    GIVEN("LANGUAGE, LC_ALL, LC_MESSAGES and LANG are not set") {
         WHEN("langauage is asked") {
             THEN("it empty") {
                 unsetenv("LANGUAGE");
                 unsetenv("LC_ALL");
+                unsetenv("LC_MESSAGES");
                 unsetenv("LANG");
                 CHECK(SystemEnvironment().language() == "");
             }
@@ -0,0 +1,124 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "timings.h"
+
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+
+namespace amm {
+
+SCENARIO("Timings") {
+    GIVEN("Timings") {
+        Timings timings;
+
+        THEN("it has no phases") {
+            CHECK(timings.phases().empty());
+            CHECK(timings.totalMilliseconds() == 0);
+        }
+
+        WHEN("phases are timed") {
+            timings.start("parse");
+            usleep(2000);
+            timings.stop();
+            timings.start("sort");
+            timings.stop();
+
+            THEN("the phases are listed in the order they first ran") {
+                std::vector<std::string> phases = timings.phases();
+                REQUIRE(phases.size() == 2);
+                CHECK(phases[0] == "parse");
+                CHECK(phases[1] == "sort");
+            }
+
+            THEN("each phase has its own time") {
+                CHECK(timings.milliseconds("parse") >= 2);
+                CHECK(timings.milliseconds("sort") < timings.milliseconds("parse"));
+                CHECK(timings.totalMilliseconds() == timings.milliseconds("parse") + timings.milliseconds("sort"));
+            }
+
+            THEN("an unknown phase took no time") {
+                CHECK(timings.milliseconds("write") == 0);
+            }
+
+            THEN("the table has a row for every phase and the total") {
+                std::string table = timings.table();
+                CHECK(table.find("Phase") == 0);
+                CHECK(table.find("\nparse ") != std::string::npos);
+                CHECK(table.find("\nsort ") != std::string::npos);
+                CHECK(table.find("\ntotal ") != std::string::npos);
+            }
+
+            THEN("the JSON lists every phase and the total") {
+                std::string json = timings.json();
+                CHECK(json.find("{\"phases\":[{\"name\":\"parse\",\"milliseconds\":") == 0);
+                CHECK(json.find("},{\"name\":\"sort\",\"milliseconds\":") != std::string::npos);
+                CHECK(json.find("],\"total_milliseconds\":") != std::string::npos);
+                CHECK(json[json.size() - 1] == '}');
+            }
+        }
+
+        WHEN("a phase is run again") {
+            timings.start("parse");
+            usleep(1000);
+            timings.stop();
+            timings.start("parse");
+            usleep(1000);
+            timings.stop();
+
+            THEN("its time accumulates") {
+                REQUIRE(timings.phases().size() == 1);
+                CHECK(timings.milliseconds("parse") >= 2);
+            }
+        }
+
+        WHEN("a phase runs inside another") {
+            timings.start("transform");
+            timings.start("icon resolution");
+            usleep(2000);
+            timings.stop();
+            timings.stop();
+
+            THEN("the inner time is not counted in the outer phase") {
+                CHECK(timings.milliseconds("icon resolution") >= 2);
+                CHECK(timings.milliseconds("transform") < 2);
+            }
+        }
+
+        WHEN("a phase is timed by scope") {
+            {
+                TimedPhase phase(&timings, "write");
+                usleep(1000);
+            }
+
+            THEN("the phase stops when the scope ends") {
+                double write_milliseconds = timings.milliseconds("write");
+                CHECK(write_milliseconds >= 1);
+                timings.start("sort");
+                usleep(1000);
+                timings.stop();
+                CHECK(timings.milliseconds("write") == write_milliseconds);
+            }
+        }
+    }
+}
+
+} // namespace amm
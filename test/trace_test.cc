@@ -0,0 +1,108 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "trace.h"
+
+#include <string>
+
+#include "doctest.h"
+#include "timings.h"
+
+namespace amm {
+
+static size_t occurrences(const std::string &text, const std::string &part)
+{
+    size_t count = 0;
+    for (size_t position = text.find(part); position != std::string::npos; position = text.find(part, position + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+SCENARIO("Trace") {
+    GIVEN("An empty trace") {
+        Trace trace;
+
+        THEN("it has no events") {
+            CHECK(trace.size() == 0);
+            CHECK(trace.json() == "{\"traceEvents\":[\n\n],\"displayTimeUnit\":\"ms\"}\n");
+        }
+    }
+
+    GIVEN("A trace with spans") {
+        Trace trace;
+        trace.addSpan("parse", "", 0, 1);
+        trace.addSpan("icon resolution", "a \"quoted\" \\name", 1, 1.5);
+
+        WHEN("written as JSON") {
+            std::string json = trace.json();
+
+            THEN("every span is a complete event") {
+                CHECK(trace.size() == 2);
+                CHECK(occurrences(json, "\"ph\":\"X\"") == 2);
+                CHECK(json.find("{\"name\":\"parse\",\"ph\":\"X\",\"ts\":") == json.find("{\"name\""));
+            }
+
+            THEN("the durations are in microseconds") {
+                CHECK(json.find("\"dur\":1000.000") != std::string::npos);
+                CHECK(json.find("\"dur\":500.000") != std::string::npos);
+            }
+
+            THEN("the detail is kept as an escaped argument") {
+                CHECK(json.find("\"args\":{\"detail\":\"a \\\"quoted\\\" \\\\name\"}") != std::string::npos);
+                CHECK(occurrences(json, "\"args\"") == 1);
+            }
+        }
+    }
+
+    GIVEN("Timings that trace") {
+        Trace trace;
+        Timings timings;
+        timings.registerTrace(trace);
+
+        WHEN("phases are timed") {
+            timings.start("parse");
+            timings.start("parse", "vlc.desktop");
+            timings.stop();
+            timings.stop();
+
+            THEN("each phase is a span, with the detail it was started with") {
+                std::string json = trace.json();
+                CHECK(trace.size() == 2);
+                CHECK(occurrences(json, "\"name\":\"parse\"") == 2);
+                CHECK(occurrences(json, "\"detail\":\"vlc.desktop\"") == 1);
+            }
+        }
+    }
+
+    GIVEN("Timings that don't trace") {
+        Trace trace;
+        Timings timings;
+
+        WHEN("phases are timed") {
+            timings.start("parse", "vlc.desktop");
+            timings.stop();
+
+            THEN("the trace stays empty") {
+                CHECK(trace.size() == 0);
+            }
+        }
+    }
+}
+
+} // namespace amm
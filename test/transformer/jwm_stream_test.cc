@@ -0,0 +1,102 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "transformer/jwm_stream.h"
+
+#include <string>
+
+#include "../doctest.h"
+
+namespace amm {
+
+SCENARIO("transformer::JwmStream") {
+    GIVEN("A JWM stream transformer") {
+        std::string output = "preamble\n";
+        transformer::JwmStream jwm_transformer(&output);
+
+        WHEN("receiving a menu start") {
+            jwm_transformer.menuStart("Menu start");
+
+            THEN("it appends the opening lines to the output") {
+                CHECK(output == "preamble\n<JWM>\n    <!--Menu start-->\n");
+            }
+        }
+
+        WHEN("receiving a menu end") {
+            jwm_transformer.menuEnd("Menu end");
+
+            THEN("it appends the closing lines to the output") {
+                CHECK(output == "preamble\n    <!--Menu end-->\n</JWM>\n");
+            }
+        }
+
+        WHEN("receiving a subcategory start") {
+            jwm_transformer.subcategoryStart("Fun & Games", "games.png");
+
+            THEN("it appends a menu line with the name XML encoded") {
+                CHECK(output == "preamble\n    <Menu label=\"Fun &amp; Games\" icon=\"games.png\">\n");
+            }
+        }
+
+        WHEN("receiving a subcategory end") {
+            jwm_transformer.subcategoryEnd("Application");
+
+            THEN("it appends the lines closing the menu, marking the end of the subcategory") {
+                CHECK(output == "preamble\n        <!--Application end-->\n    </Menu>\n");
+            }
+        }
+
+        WHEN("receiving a program") {
+            jwm_transformer.program("Shoot & Run", "shooter.png", "/usr/bin/shooter", "Shooting game");
+
+            THEN("it appends a program line with the name and icon XML encoded") {
+                CHECK(output == "preamble\n        <Program label=\"Shoot &amp; Run\" icon=\"shooter.png\">/usr/bin/shooter</Program>\n");
+            }
+        }
+
+        WHEN("receiving a program whose executable has field codes") {
+            jwm_transformer.program("Mousepad", "application-text-editor", "mousepad --new %U --tab %f", "");
+
+            THEN("the field codes are left out") {
+                CHECK(output == "preamble\n        <Program label=\"Mousepad\" icon=\"application-text-editor\">mousepad --new --tab</Program>\n");
+            }
+        }
+
+        WHEN("receiving a whole menu") {
+            jwm_transformer.menuStart("Menu start");
+            jwm_transformer.subcategoryStart("Accessories", "accessories.png");
+            jwm_transformer.program("Mousepad", "mousepad.png", "mousepad %F", "");
+            jwm_transformer.subcategoryEnd("Accessories");
+            jwm_transformer.menuEnd("Menu end");
+
+            THEN("everything is appended to the same output in order") {
+                CHECK(output == "preamble\n"
+                                "<JWM>\n"
+                                "    <!--Menu start-->\n"
+                                "    <Menu label=\"Accessories\" icon=\"accessories.png\">\n"
+                                "        <Program label=\"Mousepad\" icon=\"mousepad.png\">mousepad</Program>\n"
+                                "        <!--Accessories end-->\n"
+                                "    </Menu>\n"
+                                "    <!--Menu end-->\n"
+                                "</JWM>\n");
+            }
+        }
+    }
+}
+
+} // namespace amm
@@ -93,6 +93,19 @@ SCENARIO("transformer::Jwm") {
                 CHECK(result == "        <Program label=\"Mousepad\" icon=\"application-text-editor\">mousepad</Program>");
             }
         }
+
+        WHEN("appending representations to a buffer") {
+            std::string buffer = "preamble\n";
+            jwm_transformer.append(representation::SubcategoryStart("Fun & Games", "games.png"), &buffer);
+            buffer.push_back('\n');
+            jwm_transformer.append(representation::Program("Mousepad", "application-text-editor", "mousepad %F", "Simple Text Editor"), &buffer);
+
+            THEN("the buffer ends with the same text as each transformation") {
+                CHECK(buffer == "preamble\n"
+                                "    <Menu label=\"Fun &amp; Games\" icon=\"games.png\">\n"
+                                "        <Program label=\"Mousepad\" icon=\"application-text-editor\">mousepad</Program>");
+            }
+        }
     }
 }
 
@@ -17,6 +17,7 @@
 */
 
 #include "xdg/desktop_entry.h"
+#include "xdg/locale.h"
 
 #include <vector>
 #include <string>
@@ -95,7 +96,7 @@ SCENARIO("Populate DesktopEntry") {
 SCENARIO("Language-aware DesktopEntry") {
     GIVEN("A desktop-file") {
         DesktopEntry entry;
-        entry.hasLanguage("sr");
+        Locale serbian("sr");
 
         WHEN("created") {
             std::vector<std::string> lines;
@@ -107,7 +108,7 @@ SCENARIO("Language-aware DesktopEntry") {
             lines.push_back("Categories=Application;Utility;TextEditor;GTK;\n");
             lines.push_back("Comment=Simple Text Editor\n");
             lines.push_back("Comment[sr]=Једноставан уређивач текста\n");
-            entry.parse(lines);
+            entry.parse(lines, serbian);
 
             THEN("it picks the name with matching language") {
                 CHECK(entry.name() == "Мишоловка");
@@ -121,6 +122,41 @@ SCENARIO("Language-aware DesktopEntry") {
 }
 
 
+SCENARIO("DesktopEntry for several languages") {
+    GIVEN("A desktop-file") {
+        std::vector<std::string> lines;
+        lines.push_back("[Desktop Entry]\n");
+        lines.push_back("Name=Mousepad\n");
+        lines.push_back("Name[sr]=Мишоловка\n");
+        lines.push_back("Icon=accessories-text-editor\n");
+        lines.push_back("Exec=mousepad %F\n");
+        lines.push_back("Categories=Application;Utility;TextEditor;GTK;\n");
+        lines.push_back("Comment=Simple Text Editor\n");
+        lines.push_back("Comment[sr]=Једноставан уређивач текста\n");
+
+        WHEN("parsed for several languages") {
+            std::vector<Locale> locales;
+            locales.push_back(Locale("sr"));
+            locales.push_back(Locale("de"));
+            std::vector<DesktopEntry> entries = DesktopEntry::ParsedForEach(lines, locales);
+
+            THEN("there is an entry for each language, in order") {
+                CHECK(entries.size() == 2);
+                CHECK(entries[0].name() == "Мишоловка");
+                CHECK(entries[0].comment() == "Једноставан уређивач текста");
+                CHECK(entries[1].name() == "Mousepad");
+                CHECK(entries[1].comment() == "Simple Text Editor");
+            }
+
+            THEN("the untranslated values are shared") {
+                CHECK(entries[0].executable() == entries[1].executable());
+                CHECK(entries[0].icon() == entries[1].icon());
+                CHECK(entries[0].categories() == entries[1].categories());
+            }
+        }
+    }
+}
+
 SCENARIO("DesktopEntry comparisons") {
     DesktopEntry entry;
     DesktopEntry other_entry;
@@ -143,6 +179,21 @@ SCENARIO("DesktopEntry comparisons") {
                     CHECK(entry < other_entry);
                     CHECK_FALSE(other_entry < entry);
                 }
+
+                THEN("the desktop file collates before the other desktop file") {
+                    CHECK(entry.collationKey() < other_entry.collationKey());
+                }
+            }
+
+            WHEN("the other desktop-file has an alphabetically lesser name in lower case") {
+                std::vector<std::string> other_lines;
+                other_lines.push_back("[Desktop Entry]\n");
+                other_lines.push_back("Name=gparted");
+                other_entry.parse(other_lines);
+
+                THEN("the desktop file collates after the other desktop file") {
+                    CHECK(other_entry.collationKey() < entry.collationKey());
+                }
             }
 
             WHEN("the other desktop-file has an alphabetically lesser name") {
@@ -168,6 +219,10 @@ SCENARIO("DesktopEntry comparisons") {
                     CHECK(entry == other_entry);
                     CHECK_FALSE(other_entry != entry);
                 }
+
+                THEN("both have the same collation key") {
+                    CHECK(entry.collationKey() == other_entry.collationKey());
+                }
             }
 
             WHEN("the other desktop-file has a different name") {
@@ -195,6 +250,18 @@ SCENARIO("DesktopEntry comparisons") {
                     CHECK_FALSE(other_entry == entry);
                 }
             }
+
+            WHEN("the other desktop-file has the same name but a different executable") {
+                std::vector<std::string> other_lines;
+                other_lines.push_back("[Desktop Entry]\n");
+                other_lines.push_back("Name=Mousepad");
+                other_lines.push_back("Exec=mousepad --disable-server");
+                other_entry.parse(other_lines);
+
+                THEN("their collation keys differ") {
+                    CHECK(entry.collationKey() != other_entry.collationKey());
+                }
+            }
         }
     }
 }
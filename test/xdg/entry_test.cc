@@ -18,6 +18,7 @@
 
 #include "../doctest.h"
 #include "xdg/entry.h"
+#include "xdg/locale.h"
 
 namespace amm {
 namespace xdg {
@@ -87,6 +88,23 @@ std::vector<std::string> multipleSectionsEntry()
     return lines;
 }
 
+std::vector<std::string> singleSectionEntryLinesWithLocaleVariants()
+{
+    std::vector<std::string> lines;
+    lines.push_back("[Desktop Entry]");
+    lines.push_back("Name=Media player");
+    lines.push_back("Name[sr]=Medija plejer (sr)");
+    lines.push_back("Name[sr@latin]=Medija plejer (sr@latin)");
+    lines.push_back("Name[sr_RS]=Medija plejer (sr_RS)");
+    lines.push_back("Name[sr_RS@latin]=Medija plejer (sr_RS@latin)");
+    lines.push_back("Comment[sr]=Plejer (sr)");
+    lines.push_back("Comment[sr_RS]=Plejer (sr_RS)");
+    lines.push_back("Comment=Player");
+    lines.push_back("GenericName[sr@latin]=Plejer (sr@latin)");
+    lines.push_back("GenericName=Player");
+    return lines;
+}
+
 std::vector<std::string> noDeclarationLines()
 {
     std::vector<std::string> lines;
@@ -142,7 +160,8 @@ SCENARIO("xdg::Entry") {
     }
 
     GIVEN("An XDG file for an existing language") {
-        xdg::Entry entry(singleSectionEntryLinesWithLanguages(), "bn");
+        Locale bengali("bn");
+        xdg::Entry entry(singleSectionEntryLinesWithLanguages(), bengali);
 
         WHEN("when parsed") {
             entry.parse();
@@ -163,7 +182,8 @@ SCENARIO("xdg::Entry") {
     }
 
     GIVEN("An XDG file for a non-existing language") {
-        xdg::Entry entry(singleSectionEntryLinesWithLanguages(), "bad");
+        Locale bad("bad");
+        xdg::Entry entry(singleSectionEntryLinesWithLanguages(), bad);
 
         WHEN("when parsed") {
             entry.parse();
@@ -183,6 +203,93 @@ SCENARIO("xdg::Entry") {
         }
     }
 
+    GIVEN("An XDG file with a full locale") {
+        Locale serbian_latin("sr_RS.UTF-8@latin");
+        xdg::Entry entry(singleSectionEntryLinesWithLocaleVariants(), serbian_latin);
+
+        WHEN("when parsed") {
+            entry.parse();
+
+            THEN("a value for the exact locale is preferred") {
+                CHECK(entry.under("Desktop Entry", "Name") == "Medija plejer (sr_RS@latin)");
+            }
+
+            THEN("a value for the language and country is the next preference") {
+                CHECK(entry.under("Desktop Entry", "Comment") == "Plejer (sr_RS)");
+            }
+
+            THEN("a value for the language and modifier is preferred over the untranslated value") {
+                CHECK(entry.under("Desktop Entry", "GenericName") == "Plejer (sr@latin)");
+            }
+        }
+    }
+
+    GIVEN("An XDG file with a locale without a country") {
+        Locale serbian_latin("sr@latin");
+        xdg::Entry entry(singleSectionEntryLinesWithLocaleVariants(), serbian_latin);
+
+        WHEN("when parsed") {
+            entry.parse();
+
+            THEN("values for other countries are ignored") {
+                CHECK(entry.under("Desktop Entry", "Name") == "Medija plejer (sr@latin)");
+                CHECK(entry.under("Desktop Entry", "Comment") == "Plejer (sr)");
+            }
+        }
+    }
+
+    GIVEN("An XDG file for a locale that is gone before it is parsed") {
+        xdg::Entry entry(singleSectionEntryLinesWithLocaleVariants(), Locale("sr_RS@latin"));
+
+        WHEN("when parsed") {
+            entry.parse();
+
+            THEN("values are exposed for the locale it was created with") {
+                CHECK(entry.under("Desktop Entry", "Name") == "Medija plejer (sr_RS@latin)");
+            }
+        }
+    }
+
+    GIVEN("An XDG file parsed for several locales at once") {
+        std::vector<Locale> locales;
+        locales.push_back(Locale("sr_RS@latin"));
+        locales.push_back(Locale("sr"));
+        locales.push_back(Locale("de"));
+        xdg::Entry entry(singleSectionEntryLinesWithLocaleVariants(), locales);
+
+        WHEN("when parsed") {
+            entry.parse();
+
+            THEN("each locale gets the values it prefers") {
+                CHECK(entry.under("Desktop Entry", "Name", 0) == "Medija plejer (sr_RS@latin)");
+                CHECK(entry.under("Desktop Entry", "Name", 1) == "Medija plejer (sr)");
+                CHECK(entry.under("Desktop Entry", "Name", 2) == "Media player");
+            }
+
+            THEN("the first locale is the default one") {
+                CHECK(entry.under("Desktop Entry", "Comment") == "Plejer (sr_RS)");
+            }
+
+            THEN("an unknown locale position has no values") {
+                CHECK(entry.under("Desktop Entry", "Name", 3) == "");
+            }
+        }
+    }
+
+    GIVEN("An XDG file parsed without a locale") {
+        xdg::Entry entry(singleSectionEntryLinesWithLocaleVariants());
+
+        WHEN("when parsed") {
+            entry.parse();
+
+            THEN("the untranslated values are exposed") {
+                CHECK(entry.under("Desktop Entry", "Name") == "Media player");
+                CHECK(entry.under("Desktop Entry", "Comment") == "Player");
+                CHECK(entry.under("Desktop Entry", "GenericName") == "Player");
+            }
+        }
+    }
+
     GIVEN("An XDG file with entries that contain whitespaces") {
         xdg::Entry entry(singleSectionWithWhiteSpacesLines());
 
@@ -0,0 +1,88 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "xdg/exec.h"
+
+#include <string>
+
+#include "../doctest.h"
+
+namespace amm {
+namespace xdg {
+
+struct ExecExample
+{
+    const char *command_line;
+    const char *cleaned;
+};
+
+static const ExecExample kExecExamples[] = {
+    { "",                                          ""                                  },
+    { "mousepad",                                  "mousepad"                          },
+    { "mousepad %F",                               "mousepad"                          },
+    { "/usr/bin/vlc --started-from-file %U",       "/usr/bin/vlc --started-from-file"  },
+    { "app %f --new-window",                       "app --new-window"                  },
+    { "app %i %c %k",                              "app"                               },
+    { "app %d %D %n %N %v %m",                     "app"                               },
+    { "app %x",                                    "app"                               },
+    { "app %f%u",                                  "app"                               },
+    { "%U app",                                    "app"                               },
+    { "app --file=%f",                             "app --file="                       },
+    { "env LANG=C app --open=%u --fullscreen",     "env LANG=C app --open= --fullscreen" },
+    { "printf 100%%",                              "printf 100%"                       },
+    { "app %%f",                                   "app %f"                            },
+    { "app %",                                     "app %"                             },
+    { "  app   --one    --two  ",                  "app --one --two"                   },
+    { "\"/opt/My App/bin/app\" %U",                "\"/opt/My App/bin/app\""           },
+    { "sh -c \"echo %f done\"",                    "sh -c \"echo %f done\""            },
+    { "app \"say \\\"hi\\\" %u\" %u",              "app \"say \\\"hi\\\" %u\""         },
+    { "app \"a \\\\\" %u",                         "app \"a \\\\\""                    },
+    { "app \"\" %u",                               "app \"\""                          },
+    { "app --title=\"Two words\" %F",              "app --title=\"Two words\""         },
+    { "app \"unterminated %u",                     "app \"unterminated %u"             }
+};
+
+SCENARIO("xdg::Exec") {
+    GIVEN("Command lines from Exec keys") {
+        const size_t count = sizeof(kExecExamples) / sizeof(kExecExamples[0]);
+
+        WHEN("appended without field codes") {
+            THEN("each is cleaned as the desktop entry specification's quoting rules require") {
+                for (size_t example = 0; example < count; ++example) {
+                    std::string command_line = kExecExamples[example].command_line;
+                    std::string buffer;
+                    Exec::appendWithoutFieldCodes(command_line, &buffer);
+                    CHECK(command_line + " => " + buffer == command_line + " => " + kExecExamples[example].cleaned);
+                }
+            }
+        }
+
+        WHEN("appended after existing content") {
+            std::string command_line = "%U mousepad %F";
+            std::string buffer = "<Program>";
+            Exec::appendWithoutFieldCodes(command_line, &buffer);
+
+            THEN("the existing content is kept and no separator is added before the first argument") {
+                CHECK(buffer == "<Program>mousepad");
+            }
+        }
+    }
+}
+
+} // namespace xdg
+} // namespace amm
@@ -0,0 +1,106 @@
+/*
+  This file is part of mjwm.
+  Copyright (C) 2014-2016  Chirantan Mitra <chirantan.mitra@gmail.com>
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "xdg/locale.h"
+
+#include <string>
+#include <vector>
+
+#include "../doctest.h"
+
+namespace amm {
+namespace xdg {
+
+SCENARIO("xdg::Locale") {
+    GIVEN("A locale with language, country, encoding and modifier") {
+        Locale locale("sr_RS.UTF-8@latin");
+
+        WHEN("its candidates are asked") {
+            THEN("they are ordered by preference without the encoding") {
+                std::vector<std::string> candidates = locale.candidates();
+                REQUIRE(candidates.size() == 4);
+                CHECK(candidates[0] == "sr_RS@latin");
+                CHECK(candidates[1] == "sr_RS");
+                CHECK(candidates[2] == "sr@latin");
+                CHECK(candidates[3] == "sr");
+            }
+        }
+
+        WHEN("ranked against a part of a key") {
+            std::string key = "Name[sr@latin]";
+
+            THEN("the rank is the position of the matching candidate") {
+                CHECK(locale.rank(key, 5, 8) == 2);
+            }
+        }
+
+        WHEN("ranked against a locale that is not a candidate") {
+            std::string key = "Name[sr_ME]";
+
+            THEN("it has no match") {
+                CHECK(locale.rank(key, 5, 5) == Locale::kNoMatch);
+            }
+        }
+
+        WHEN("the rank of an unlocalized key is asked") {
+            THEN("it ranks below all candidates") {
+                CHECK(locale.unlocalizedRank() == 4);
+            }
+        }
+    }
+
+    GIVEN("A locale with language and country") {
+        Locale locale("en_IN");
+
+        WHEN("its candidates are asked") {
+            THEN("they are the language with and without the country") {
+                std::vector<std::string> candidates = locale.candidates();
+                REQUIRE(candidates.size() == 2);
+                CHECK(candidates[0] == "en_IN");
+                CHECK(candidates[1] == "en");
+            }
+        }
+    }
+
+    GIVEN("A locale with language and modifier") {
+        Locale locale("sr@latin");
+
+        WHEN("its candidates are asked") {
+            THEN("they are the language with and without the modifier") {
+                std::vector<std::string> candidates = locale.candidates();
+                REQUIRE(candidates.size() == 2);
+                CHECK(candidates[0] == "sr@latin");
+                CHECK(candidates[1] == "sr");
+            }
+        }
+    }
+
+    GIVEN("An empty locale") {
+        Locale locale("");
+
+        WHEN("its candidates are asked") {
+            THEN("there are none") {
+                CHECK(locale.candidates().empty());
+                CHECK(locale.unlocalizedRank() == 0);
+            }
+        }
+    }
+}
+
+} // namespace xdg
+} // namespace amm